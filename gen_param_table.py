@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+"""
+Generate src/param_table.c/.h from docs/X18_OSC_Commands.json
+
+Each catalogue entry becomes a parameter template: the OSC address of
+instance 0 (NUL-padded to a multiple of 4), the offsets of its index digits,
+the type tag, the value law and range on the console's step grid, and a
+default. Parameter IDs are (template << 8) | (index_a << 4) | index_b.
+
+Run it after editing the catalogue (the Makefile does it automatically):
+
+    python3 gen_param_table.py
+"""
+
+import json
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+CATALOGUE = os.path.join(ROOT, 'docs', 'X18_OSC_Commands.json')
+OUT_H = os.path.join(ROOT, 'src', 'param_table.h')
+OUT_C = os.path.join(ROOT, 'src', 'param_table.c')
+
+# Number of instances of an index field, keyed by the path segment before it
+# (see "notes" in the catalogue)
+INDEX_COUNTS = {
+    'ch': 16,
+    'bus': 6,
+    'dca': 4,
+    'headamp': 16,
+    'mix': 10,      # Channel sends: buses 1-6, FX 7-10
+    'eq': 5,        # Bands edited by the app
+    'mute': 4,      # Mute groups
+    'solosw': 16,
+}
+
+# X-Air step grids for float parameters, keyed by the catalogue's value range.
+# The catalogue only documents the endpoints.
+#   range text        : (law, min, max, steps, default)
+FLOAT_LAWS = {
+    '-oo - +10':        ('FADER', -90.0, 10.0, 1024, None),
+    '-100 - +100':      ('LIN', -100.0, 100.0, 101, 0.0),
+    '-12 - +60':        ('LIN', -12.0, 60.0, 145, 0.0),
+    '20 - 200':         ('LOG', 20.0, 200.0, 101, 20.0),
+    '20 - 20000':       ('LOG', 20.0, 20000.0, 201, 1000.0),
+    '-15.0 - +15.0':    ('LIN', -15.0, 15.0, 61, 0.0),
+    '10.0 - 0.3':       ('LOG', 10.0, 0.3, 72, 2.0),
+    '-80.0 - 0.0':      ('LIN', -80.0, 0.0, 161, -80.0),
+    '3.0 - 60.0':       ('LIN', 3.0, 60.0, 58, 60.0),
+    '0.0 - 120.0':      ('LIN', 0.0, 120.0, 121, 10.0),
+    '0.02 - 2000':      ('LOG', 0.02, 2000.0, 101, 20.0),
+    '5.0 - 4000.0':     ('LOG', 5.0, 4000.0, 101, 100.0),
+    '-60.0 - 0.0':      ('LIN', -60.0, 0.0, 121, 0.0),
+    '0.0 - 5.0':        ('LIN', 0.0, 5.0, 6, 0.0),
+    '0.0 - 24.0':       ('LIN', 0.0, 24.0, 49, 0.0),
+}
+
+GROUPS = [
+    ('Action', 'ACTION'),
+    ('Channel', 'CHANNEL'),
+    ('Channel EQ', 'EQ'),
+    ('Channel Gate', 'GATE'),
+    ('Channel Compressor', 'DYN'),
+    ('Bus', 'BUS'),
+    ('Main LR', 'MAIN'),
+    ('DCA', 'DCA'),
+    ('Headamp', 'HEADAMP'),
+    ('Config', 'CONFIG'),
+    ('Snapshot', 'SNAPSHOT'),
+    ('Status', 'STATUS'),
+]
+GROUP_ENUM = dict(GROUPS)
+
+
+def fail(msg):
+    sys.stderr.write('gen_param_table: %s\n' % msg)
+    sys.exit(1)
+
+
+def expand_pairs(cmd):
+    """/config/chlink/1-2 stands for the 8 channel pairs"""
+    m = re.search(r'/(\d+)-(\d+)$', cmd['path'])
+    if not m:
+        return [cmd]
+    out = []
+    for a in range(1, 17, 2):
+        c = dict(cmd)
+        c['path'] = cmd['path'][:m.start()] + '/%d-%d' % (a, a + 1)
+        out.append(c)
+    return out
+
+
+def index_fields(path):
+    """Return [(offset, width, count)] for each numeric index segment"""
+    fields = []
+    segs = path.split('/')
+    offset = 0
+    for i, seg in enumerate(segs):
+        if seg.isdigit() and i > 0 and segs[i - 1] in INDEX_COUNTS:
+            fields.append((offset, len(seg), INDEX_COUNTS[segs[i - 1]]))
+        offset += len(seg) + 1
+    if len(fields) > 2:
+        fail('%s: more than two index fields' % path)
+    for off, width, count in fields:
+        if count > 16 or (width == 1 and count > 9):
+            fail('%s: index does not fit its field' % path)
+    return fields
+
+
+def enum_name(path):
+    name = re.sub(r'/mix/\d+/', '/send/', path)   # /ch/01/mix/01/pan vs /ch/01/mix/pan
+    name = re.sub(r'/\d+(?=/|$)', '', name)
+    name = re.sub(r'[^A-Za-z0-9]+', '_', name).strip('_').upper()
+    return 'PT_' + name
+
+
+def law_step(law, lo, hi, steps, value):
+    if law == 'LIN':
+        norm = (value - lo) / (hi - lo)
+    elif law == 'LOG':
+        norm = math.log(value / lo) / math.log(hi / lo)
+    else:
+        return 0
+    return max(0, min(steps - 1, int(round(norm * (steps - 1)))))
+
+
+def describe(cmd):
+    t = cmd['type']
+    if t == 's':
+        return ('NONE', 0.0, 0.0, 0, 0)
+    if t == 'i':
+        rng = cmd['range'].split('-')
+        lo = int(rng[0])
+        hi = int(rng[-1])
+        return ('INT', float(lo), float(hi), hi - lo + 1, 0)
+    if t == 'f':
+        key = cmd['values'].strip()
+        if key not in FLOAT_LAWS:
+            fail('%s: no step grid for range "%s"' % (cmd['path'], key))
+        law, lo, hi, steps, default = FLOAT_LAWS[key]
+        def_step = 0 if default is None else law_step(law, lo, hi, steps, default)
+        return (law, lo, hi, steps, def_step)
+    fail('%s: unknown type %s' % (cmd['path'], t))
+
+
+def c_string(s):
+    return '"' + s.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def c_float(v):
+    return ('%.6g' % v) + ('' if '.' in ('%.6g' % v) or 'e' in ('%.6g' % v) else '.0') + 'f'
+
+
+def padded(path):
+    """Address with its NUL padding as a C literal, and the padded length"""
+    n = len(path) + 1
+    n += (4 - n % 4) % 4
+    return c_string(path) + ''.join('"\\0"' for _ in range(n - len(path) - 1)), n
+
+
+def address_pattern(path):
+    return re.sub(r'\d+', '#', path)
+
+
+def fnv1a(s):
+    h = 0x811C9DC5
+    for ch in s.encode():
+        h ^= ch
+        h = (h * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def main():
+    with open(CATALOGUE) as f:
+        catalogue = json.load(f)
+
+    templates = []
+    for cmd in catalogue['commands']:
+        for c in expand_pairs(cmd):
+            templates.append(c)
+
+    if len(templates) > 255:
+        fail('too many templates for an 8-bit template id')
+
+    names = [enum_name(t['path']) for t in templates]
+    if len(set(names)) != len(names):
+        dupes = sorted(set(n for n in names if names.count(n) > 1))
+        fail('duplicate template names: %s' % ', '.join(dupes))
+
+    header = '// Generated by gen_param_table.py from docs/X18_OSC_Commands.json - do not edit\n\n'
+
+    h = [header, '#ifndef PARAM_TABLE_H\n#define PARAM_TABLE_H\n\n']
+    h.append('typedef enum {\n')
+    for name, t in zip(names, templates):
+        h.append('    %-28s // %s\n' % (name + ',', t['path']))
+    h.append('    PT_COUNT\n} ParamTemplateId;\n\n')
+    h.append('#define PARAM_LOOKUP_SIZE %d\n\n' % len(templates))
+    h.append('#endif\n')
+
+    c = [header, '#include "param.h"\n\n']
+    c.append('const ParamTemplate g_param_templates[PT_COUNT] = {\n')
+    for name, t in zip(names, templates):
+        law, lo, hi, steps, def_step = describe(t)
+        fields = index_fields(t['path'])
+        while len(fields) < 2:
+            fields.append((0, 0, 1))
+        addr, addr_len = padded(t['path'])
+        c.append('    [%s] = {\n' % name)
+        c.append('        %s, %d,\n' % (addr, addr_len))
+        c.append('        { %d, %d }, { %d, %d }, { %d, %d },\n' % (
+            fields[0][0], fields[1][0], fields[0][1], fields[1][1], fields[0][2], fields[1][2]))
+        c.append("        '%s', PARAM_LAW_%s, PARAM_GROUP_%s, %d, %d,\n" % (
+            t['type'], law, GROUP_ENUM[t['category']], steps, def_step))
+        c.append('        %s, %s,\n' % (c_float(lo), c_float(hi)))
+        c.append('        %s\n' % c_string(t['description']))
+        c.append('    },\n')
+    c.append('};\n\n')
+
+    # Address lookup: FNV-1a of the address with every digit run replaced by
+    # '#', sorted so param_find() can binary search it. Templates sharing a
+    # pattern are adjacent and told apart by comparing the full address.
+    lookup = sorted((fnv1a(address_pattern(t['path'])), i, name)
+                    for i, (name, t) in enumerate(zip(names, templates)))
+    c.append('const ParamLookup g_param_lookup[PARAM_LOOKUP_SIZE] = {\n')
+    for hsh, _, name in lookup:
+        c.append('    { 0x%08Xu, %s },\n' % (hsh, name))
+    c.append('};\n')
+
+    for path, text in ((OUT_H, ''.join(h)), (OUT_C, ''.join(c))):
+        with open(path, 'w') as f:
+            f.write(text)
+    print('gen_param_table: %d templates -> %s, %s' % (
+        len(templates), os.path.relpath(OUT_H, ROOT), os.path.relpath(OUT_C, ROOT)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,530 @@
+// ============================================================================
+// HOST MICROBENCHMARKS
+// ============================================================================
+// Times the core's hot paths on Linux (Makefile.host) and compares them with
+// a saved baseline:
+//
+//   x18bench                          Print ns/op and allocations/op
+//   x18bench --save FILE              Also write the results as the baseline
+//   x18bench --check FILE [--threshold PCT]
+//                                     Exit 1 if any benchmark is slower than
+//                                     its baseline by more than PCT (default
+//                                     25) or allocates more per op
+//   x18bench --filter TEXT            Only benchmarks whose name contains TEXT
+//
+// Each benchmark is calibrated to run for about BENCH_TARGET_MS, then timed
+// BENCH_REPEATS times; the fastest run is reported (the others only add
+// scheduler noise). Time is the benchmark thread's CPU time, so preemption
+// is left out, and shows are saved to and loaded from a memory stream
+// (show_write_stream / show_read_stream): the numbers track the code, not
+// the machine's load or its disk. Allocations are malloc/calloc/realloc calls made by the
+// core, counted by wrapping them at link time (-Wl,--wrap), so stdio's own
+// buffers are not included.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "platform.h"
+#include "show.h"
+#include "param.h"
+#include "xair_codec.h"
+#include "fader_taper.h"
+#include "eq_engine.h"
+#include "link_health.h"
+
+#define BENCH_TARGET_MS     200
+#define BENCH_REPEATS       7
+#define BENCH_CONFIRM       5       // Re-runs of a result over the threshold before it counts
+#define BENCH_CONFIRM_GAP_MS 250    // Pause before each, to let a burst of host load pass
+#define BENCH_MAX           32
+#define BENCH_SHOW_BYTES    (512 * 1024)    // The 200-step fixture is about 330 KB
+#define BENCH_PARAMS_PER_STEP   12  // Stored params per step besides faders, mutes and EQ
+
+typedef void (*BenchFunc)(u32 iterations);
+
+typedef struct {
+    char name[48];
+    double ns_per_op;
+    double allocs_per_op;
+    BenchFunc fn;
+    int show_steps;         // Size of the fixture show it runs on
+    u32 iterations;
+} BenchResult;
+
+// ============================================================================
+// ALLOCATION COUNTING
+// ============================================================================
+
+static volatile u64 s_allocs = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    __atomic_fetch_add(&s_allocs, 1, __ATOMIC_RELAXED);
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size)
+{
+    __atomic_fetch_add(&s_allocs, 1, __ATOMIC_RELAXED);
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    __atomic_fetch_add(&s_allocs, 1, __ATOMIC_RELAXED);
+    return __real_realloc(ptr, size);
+}
+
+// ============================================================================
+// FIXTURES
+// ============================================================================
+
+static Show s_show;
+static Show s_loaded;
+static u8 s_show_file[BENCH_SHOW_BYTES];   // s_show as saved, for the loads
+static size_t s_show_file_len = 0;
+static volatile u32 s_sink;         // Keeps results alive past the optimizer
+
+static u32 s_rand = 0x12345678u;
+
+static u32 rand_next(void)
+{
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand;
+}
+
+static float rand_unit(void)
+{
+    return (float)(rand_next() & 0xFFFF) / 65535.0f;
+}
+
+static void fill_step(Step *step, int index)
+{
+    snprintf(step->name, sizeof(step->name), "Cue %d", index + 1);
+    for (int ch = 0; ch < 16; ch++) {
+        step->volumes[ch] = rand_unit();
+        step->mutes[ch] = (rand_next() & 7) == 0;
+        init_channel_eq(&step->eqs[ch]);
+        step->eqs[ch].enabled = 1;
+        for (int b = 0; b < 5; b++) {
+            step->eqs[ch].bands[b].gain = rand_unit() * 30.0f - 15.0f;
+            step->eqs[ch].bands[b].frequency *= 0.5f + rand_unit();
+        }
+    }
+    // Sends and dynamics, as a typical stored cue
+    for (int i = 0; i < BENCH_PARAMS_PER_STEP; i++) {
+        u16 id = PARAM_ID(PT_CH_SEND_LEVEL, i % 16, i / 16);
+        param_list_set(&step->params, id, (u16)(rand_next() % param_template(id)->steps));
+    }
+    step->fade_tenths = (u16)(rand_next() % 50);
+}
+
+static void build_show(Show *show, int steps)
+{
+    show_clear(show);
+    s_rand = 0x12345678u;
+    snprintf(show->name, sizeof(show->name), "Bench %d", steps);
+    show->magic = SHOW_MAGIC;
+    show->num_steps = steps;
+    for (int s = 0; s < steps; s++) fill_step(&show->steps[s], s);
+}
+
+// What a full recall of a step puts on the wire, as registry (id, step) pairs
+// (the same walk send_step_osc() does, without the socket)
+#define STEP_MAX_MESSAGES   (16 * (2 + 5 * 4) + BENCH_PARAMS_PER_STEP)
+
+static int step_messages(const Step *step, u16 *ids, int *steps)
+{
+    static const u8 band_templates[4] = { PT_CH_EQ_TYPE, PT_CH_EQ_F, PT_CH_EQ_G, PT_CH_EQ_Q };
+    int n = 0;
+    for (int ch = 0; ch < 16; ch++) {
+        ids[n] = PARAM_ID(PT_CH_MIX_FADER, ch, 0);
+        steps[n++] = fader_value_to_step(step->volumes[ch]);
+        ids[n] = PARAM_ID(PT_CH_MIX_ON, ch, 0);
+        steps[n++] = step->mutes[ch] ? 0 : 1;
+        for (int b = 0; b < 5; b++) {
+            const EQBand *band = &step->eqs[ch].bands[b];
+            float values[4] = { (float)band->type, band->frequency, band->gain, band->q_factor };
+            for (int p = 0; p < 4; p++) {
+                ids[n] = PARAM_ID(band_templates[p], ch, b);
+                steps[n] = (p == 0) ? (int)band->type : param_value_to_step(ids[n], values[p]);
+                n++;
+            }
+        }
+    }
+    for (int i = 0; i < step->params.count; i++) {
+        ids[n] = step->params.items[i].id;
+        steps[n++] = step->params.items[i].step;
+    }
+    return n;
+}
+
+// ============================================================================
+// BENCHMARKS
+// ============================================================================
+
+static void bench_osc_encode_msg(u32 iterations)
+{
+    u8 packet[PARAM_PACKET_MAX];
+    u32 total = 0;
+    for (u32 i = 0; i < iterations; i++) {
+        int ch = i & 15;
+        u16 id = (i & 16) ? PARAM_ID(PT_CH_EQ_F, ch, i % 5) : PARAM_ID(PT_CH_MIX_FADER, ch, 0);
+        total += param_encode(id, (int)(i % 200), packet, sizeof(packet));
+    }
+    s_sink = total;
+}
+
+static void bench_osc_encode_step(u32 iterations)
+{
+    u16 ids[STEP_MAX_MESSAGES];
+    int steps[STEP_MAX_MESSAGES];
+    u8 packet[PARAM_PACKET_MAX];
+    u32 total = 0;
+    for (u32 i = 0; i < iterations; i++) {
+        const Step *step = &s_show.steps[i % s_show.num_steps];
+        int n = step_messages(step, ids, steps);
+        for (int m = 0; m < n; m++) total += param_encode(ids[m], steps[m], packet, sizeof(packet));
+    }
+    s_sink = total;
+}
+
+// Bytes written to s_show_file, 0 on failure
+static size_t save_show_memory(const Show *show)
+{
+    FILE *f = fmemopen(s_show_file, sizeof(s_show_file), "wb");
+    if (!f) return 0;
+    int ok = show_write_stream(f, show) && fflush(f) == 0;
+    long len = ftell(f);
+    fclose(f);
+    return (ok && len > 0) ? (size_t)len : 0;
+}
+
+static void bench_show_save(u32 iterations)
+{
+    u32 ok = 0;
+    for (u32 i = 0; i < iterations; i++) ok += save_show_memory(&s_show) > 0;
+    s_sink = ok;
+}
+
+static void bench_show_load(u32 iterations)
+{
+    u32 ok = 0;
+    for (u32 i = 0; i < iterations; i++) {
+        FILE *f = fmemopen(s_show_file, s_show_file_len, "rb");
+        if (!f) continue;
+        ok += show_read_stream(f, &s_loaded);
+        fclose(f);
+    }
+    s_sink = ok;
+}
+
+// Dragging one band: one band recomputed per frame
+static void bench_eq_curve_drag(u32 iterations)
+{
+    static EQCurveCache cache;
+    ChannelEQ eq = s_show.steps[0].eqs[0];
+    eq_curve_update(&cache, &eq);
+    u32 total = 0;
+    for (u32 i = 0; i < iterations; i++) {
+        eq.bands[2].gain = (float)((int)(i % 61) - 30) * 0.5f;
+        total += eq_curve_update(&cache, &eq);
+    }
+    s_sink = total;
+}
+
+// Channel switch: all five bands recomputed
+static void bench_eq_curve_full(u32 iterations)
+{
+    static EQCurveCache cache;
+    u32 total = 0;
+    for (u32 i = 0; i < iterations; i++) {
+        cache.valid = 0;
+        total += eq_curve_update(&cache, &s_show.steps[0].eqs[i & 15]);
+    }
+    s_sink = total;
+}
+
+static void bench_fader_taper(u32 iterations)
+{
+    u32 total = 0;
+    for (u32 i = 0; i < iterations; i++) {
+        int step = fader_value_to_step((float)(i & 1023) / 1023.0f);
+        total += (u32)fader_db_to_step(fader_step_to_db(step)) + (u32)fader_step_to_db_q8(step);
+    }
+    s_sink = total;
+}
+
+// skip_unchanged between consecutive cues: compare every fader and EQ value
+// of the next step with the console shadow and update what differs
+static void bench_step_delta(u32 iterations)
+{
+    u16 ids[STEP_MAX_MESSAGES];
+    int steps[STEP_MAX_MESSAGES];
+    u32 changed = 0;
+    xair_shadow_reset();
+    for (u32 i = 0; i < iterations; i++) {
+        const Step *step = &s_show.steps[i % s_show.num_steps];
+        step_messages(step, ids, steps);
+        int m = 0;
+        for (int ch = 0; ch < 16; ch++) {
+            if (!xair_shadow_fader_same(ch, steps[m])) {
+                xair_shadow_fader_set(ch, steps[m]);
+                changed++;
+            }
+            m += 2;     // Fader, mute
+            for (int b = 0; b < 5; b++) {
+                for (int p = 0; p < XAIR_EQ_NUM_PARAMS; p++, m++) {
+                    if (!xair_shadow_eq_same(ch, b, (XAirEqParam)p, steps[m])) {
+                        xair_shadow_eq_set(ch, b, (XAirEqParam)p, steps[m]);
+                        changed++;
+                    }
+                }
+            }
+        }
+    }
+    s_sink = changed;
+}
+
+// /xremote feedback: decode a mix of fader, mute and EQ messages
+#define FEEDBACK_PACKETS 64
+static u8 s_feedback[FEEDBACK_PACKETS][PARAM_PACKET_MAX];
+static int s_feedback_len[FEEDBACK_PACKETS];
+
+static void build_feedback(void)
+{
+    u16 ids[STEP_MAX_MESSAGES];
+    int steps[STEP_MAX_MESSAGES];
+    int n = step_messages(&s_show.steps[0], ids, steps);
+    for (int i = 0; i < FEEDBACK_PACKETS; i++) {
+        int m = (i * 7) % n;
+        s_feedback_len[i] = param_encode(ids[m], steps[m], s_feedback[i], PARAM_PACKET_MAX);
+    }
+}
+
+static void bench_feedback_parse(u32 iterations)
+{
+    u32 total = 0;
+    for (u32 i = 0; i < iterations; i++) {
+        int p = i % FEEDBACK_PACKETS;
+        u16 id;
+        int step;
+        if (param_decode(s_feedback[p], s_feedback_len[p], &id, &step)) total += id + step;
+    }
+    s_sink = total;
+}
+
+static void bench_xinfo_parse(u32 iterations)
+{
+    // "/xinfo" ,ssss ip name model firmware
+    static const u8 reply[] = "/xinfo\0\0,ssss\0\0\0" "192.168.1.50\0\0\0\0" "XR18-5E-7A-12\0\0\0"
+                              "XR18\0\0\0\0" "1.17\0\0\0\0";
+    MixerInfo info;
+    u32 ok = 0;
+    for (u32 i = 0; i < iterations; i++) ok += xinfo_parse(reply, (int)sizeof(reply) - 1, &info);
+    s_sink = ok;
+}
+
+// ============================================================================
+// RUNNER
+// ============================================================================
+
+static BenchResult s_results[BENCH_MAX];
+static int s_num_results = 0;
+static const char *s_filter = NULL;
+
+static u64 now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (u64)ts.tv_sec * 1000000000ULL + (u64)ts.tv_nsec;
+}
+
+// Fixture show of the given size, also saved to s_show_file for the loads
+static void prepare(int steps)
+{
+    if (s_show.num_steps == steps) return;
+    build_show(&s_show, steps);
+    s_show_file_len = save_show_memory(&s_show);
+    if (s_show_file_len == 0) {
+        fprintf(stderr, "x18bench: a %d-step show does not fit in %d bytes\n", steps, BENCH_SHOW_BYTES);
+        exit(1);
+    }
+    build_feedback();
+}
+
+// Timed runs; keeps the fastest seen so far
+static void measure(BenchResult *res)
+{
+    u64 allocs = 0;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        u64 allocs_before = s_allocs;
+        u64 start = now_ns();
+        res->fn(res->iterations);
+        double ns = (double)(now_ns() - start) / res->iterations;
+        if (res->ns_per_op == 0.0 || ns < res->ns_per_op) res->ns_per_op = ns;
+        allocs = s_allocs - allocs_before;
+    }
+    res->allocs_per_op = (double)allocs / res->iterations;
+}
+
+static void run(const char *name, BenchFunc fn, int show_steps)
+{
+    if (s_filter && !strstr(name, s_filter)) return;
+    if (s_num_results >= BENCH_MAX) return;
+    prepare(show_steps);
+
+    // Grow the iteration count until one run takes long enough to time
+    u32 iterations = 1;
+    for (;;) {
+        u64 start = now_ns();
+        fn(iterations);
+        u64 elapsed = now_ns() - start;
+        if (elapsed >= (u64)BENCH_TARGET_MS * 1000000ULL / 4 || iterations >= (1u << 30)) break;
+        iterations *= (elapsed < 1000000ULL) ? 10 : 2;
+    }
+
+    BenchResult *res = &s_results[s_num_results++];
+    memset(res, 0, sizeof(*res));
+    snprintf(res->name, sizeof(res->name), "%s", name);
+    res->fn = fn;
+    res->show_steps = show_steps;
+    res->iterations = iterations;
+    measure(res);
+    printf("%-24s %12.1f ns/op %10.2f allocs/op %12lu ops\n", res->name, res->ns_per_op,
+           res->allocs_per_op, (unsigned long)iterations);
+}
+
+static void run_show_files(int steps)
+{
+    const int max_steps = (int)(sizeof(s_show.steps) / sizeof(s_show.steps[0]));
+    char name[48];
+    if (steps > max_steps) {
+        snprintf(name, sizeof(name), "show_*_%d", steps);
+        printf("%-24s skipped: a show holds at most %d steps\n", name, max_steps);
+        return;
+    }
+    snprintf(name, sizeof(name), "show_save_%d", steps);
+    run(name, bench_show_save, steps);
+    snprintf(name, sizeof(name), "show_load_%d", steps);
+    run(name, bench_show_load, steps);
+}
+
+// Baseline file: one result per line, as written by save_baseline()
+static int save_baseline(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (!f) return 0;
+    fprintf(f, "{\n  \"results\": [\n");
+    for (int i = 0; i < s_num_results; i++) {
+        fprintf(f, "    {\"name\": \"%s\", \"ns_per_op\": %.1f, \"allocs_per_op\": %.2f}%s\n",
+                s_results[i].name, s_results[i].ns_per_op, s_results[i].allocs_per_op,
+                i + 1 < s_num_results ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    return fclose(f) == 0;
+}
+
+static int check_baseline(const char *path, double threshold_pct)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "x18bench: cannot read baseline %s\n", path);
+        return 0;
+    }
+
+    int failed = 0;
+    int compared = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        BenchResult base;
+        if (sscanf(line, " {\"name\": \"%47[^\"]\", \"ns_per_op\": %lf, \"allocs_per_op\": %lf",
+                   base.name, &base.ns_per_op, &base.allocs_per_op) != 3) {
+            continue;
+        }
+        for (int i = 0; i < s_num_results; i++) {
+            BenchResult *res = &s_results[i];
+            if (strcmp(res->name, base.name) != 0) continue;
+            compared++;
+            // A slow result is timed again before it counts: one noisy run
+            // on a shared machine is not a regression
+            for (int c = 0; c < BENCH_CONFIRM &&
+                            res->ns_per_op > base.ns_per_op * (1.0 + threshold_pct / 100.0); c++) {
+                usleep(BENCH_CONFIRM_GAP_MS * 1000);
+                prepare(res->show_steps);
+                measure(res);
+            }
+            double change = (res->ns_per_op - base.ns_per_op) * 100.0 / base.ns_per_op;
+            int slower = change > threshold_pct;
+            int allocs = res->allocs_per_op > base.allocs_per_op + 0.005;
+            if (slower || allocs) failed++;
+            printf("%-24s %+7.1f%% time, %.2f -> %.2f allocs/op%s\n", res->name, change,
+                   base.allocs_per_op, res->allocs_per_op,
+                   slower ? "  REGRESSED (time)" : allocs ? "  REGRESSED (allocations)" : "");
+        }
+    }
+    fclose(f);
+
+    printf("%d of %d compared regressed past %.0f%%\n", failed, compared, threshold_pct);
+    return failed == 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *save_path = NULL;
+    const char *check_path = NULL;
+    double threshold_pct = 25.0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--save") && i + 1 < argc) {
+            save_path = argv[++i];
+        } else if (!strcmp(argv[i], "--check") && i + 1 < argc) {
+            check_path = argv[++i];
+        } else if (!strcmp(argv[i], "--threshold") && i + 1 < argc) {
+            threshold_pct = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--filter") && i + 1 < argc) {
+            s_filter = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--save FILE] [--check FILE] [--threshold PCT] [--filter TEXT]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+
+    fader_taper_init();
+    xair_codec_init();
+    eq_engine_init();
+
+    run("osc_encode_msg", bench_osc_encode_msg, 50);
+    run("osc_encode_step", bench_osc_encode_step, 50);
+    run("eq_curve_drag", bench_eq_curve_drag, 50);
+    run("eq_curve_full", bench_eq_curve_full, 50);
+    run("fader_taper", bench_fader_taper, 50);
+    run("step_delta", bench_step_delta, 50);
+    run("feedback_parse", bench_feedback_parse, 50);
+    run("xinfo_parse", bench_xinfo_parse, 50);
+
+    static const int show_sizes[] = { 3, 50, 200, 1000 };
+    for (size_t i = 0; i < sizeof(show_sizes) / sizeof(show_sizes[0]); i++) run_show_files(show_sizes[i]);
+
+    if (save_path) {
+        if (!save_baseline(save_path)) {
+            fprintf(stderr, "x18bench: cannot write %s\n", save_path);
+            return 1;
+        }
+        printf("Baseline written to %s\n", save_path);
+    }
+    int ok = !check_path || check_baseline(check_path, threshold_pct);
+    show_clear(&s_show);
+    show_clear(&s_loaded);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+#ifndef HEADLESS_3DS_H
+#define HEADLESS_3DS_H
+
+// ============================================================================
+// HEADLESS LIBCTRU
+// ============================================================================
+// What the UI (main.c, common.c, the windows) uses of libctru beyond the
+// core's platform subset, for the headless host build (Makefile.host
+// headless). Implemented in host/headless/headless.c: graphics and services
+// do nothing, input comes from input.h's replay or script source.
+
+#include "platform_posix.h"
+
+// Button bits as in libctru's hid.h, so recordings from the console replay as is
+enum {
+    KEY_A       = BIT(0),
+    KEY_B       = BIT(1),
+    KEY_SELECT  = BIT(2),
+    KEY_START   = BIT(3),
+    KEY_DRIGHT  = BIT(4),
+    KEY_DLEFT   = BIT(5),
+    KEY_DUP     = BIT(6),
+    KEY_DDOWN   = BIT(7),
+    KEY_R       = BIT(8),
+    KEY_L       = BIT(9),
+    KEY_X       = BIT(10),
+    KEY_Y       = BIT(11),
+    KEY_ZL      = BIT(14),
+    KEY_ZR      = BIT(15),
+    KEY_TOUCH   = BIT(20),
+    KEY_CSTICK_RIGHT = BIT(24),
+    KEY_CSTICK_LEFT  = BIT(25),
+    KEY_CSTICK_UP    = BIT(26),
+    KEY_CSTICK_DOWN  = BIT(27),
+    KEY_CPAD_RIGHT   = BIT(28),
+    KEY_CPAD_LEFT    = BIT(29),
+    KEY_CPAD_UP      = BIT(30),
+    KEY_CPAD_DOWN    = BIT(31),
+
+    KEY_UP      = KEY_DUP    | KEY_CPAD_UP,
+    KEY_DOWN    = KEY_DDOWN  | KEY_CPAD_DOWN,
+    KEY_LEFT    = KEY_DLEFT  | KEY_CPAD_LEFT,
+    KEY_RIGHT   = KEY_DRIGHT | KEY_CPAD_RIGHT,
+};
+
+typedef struct {
+    u16 px;
+    u16 py;
+} touchPosition;
+
+// Frame loop: false once the input source has run out
+bool aptMainLoop(void);
+void gspWaitForVBlank(void);
+
+#define GFX_TOP     0
+#define GFX_BOTTOM  1
+#define GFX_LEFT    0
+
+void gfxInitDefault(void);
+void gfxExit(void);
+
+Result fsInit(void);
+void fsExit(void);
+Result romfsInit(void);
+Result romfsExit(void);
+Result socInit(u32 *context_addr, u32 context_size);
+Result socExit(void);
+
+typedef enum {
+    CFG_REGION_JPN = 0,
+    CFG_REGION_USA = 1,
+    CFG_REGION_EUR = 2,
+} CFG_Region;
+
+#endif
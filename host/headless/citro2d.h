@@ -0,0 +1,80 @@
+#ifndef HEADLESS_CITRO2D_H
+#define HEADLESS_CITRO2D_H
+
+// citro2d as far as the UI uses it (host/headless/3ds.h). Nothing is drawn;
+// the calls stay so the UI's own per-frame work is what gets measured.
+
+#include <citro3d.h>
+
+typedef struct {
+    C3D_Tex *tex;
+    const void *subtex;
+} C2D_Image;
+
+typedef struct {
+    u32 color;
+    float blend;
+} C2D_Tint;
+
+typedef struct {
+    C2D_Tint corners[4];
+} C2D_ImageTint;
+
+typedef struct C2D_SpriteSheet_s *C2D_SpriteSheet;
+typedef struct C2D_TextBuf_s *C2D_TextBuf;
+typedef struct C2D_Font_s *C2D_Font;
+
+typedef struct {
+    C2D_TextBuf buf;
+    size_t begin;
+    size_t end;
+    float width;
+    u32 lines;
+    u32 words;
+    C2D_Font font;
+} C2D_Text;
+
+#define C2D_DEFAULT_MAX_OBJECTS 4096
+
+#define C2D_AtBaseline      BIT(0)
+#define C2D_WithColor       BIT(1)
+#define C2D_AlignLeft       (0 << 2)
+#define C2D_AlignRight      (1 << 2)
+#define C2D_AlignCenter     (2 << 2)
+
+static inline u32 C2D_Color32(u8 r, u8 g, u8 b, u8 a)
+{
+    return r | (g << 8) | (b << 16) | ((u32)a << 24);
+}
+
+bool C2D_Init(size_t maxObjects);
+void C2D_Fini(void);
+void C2D_Prepare(void);
+void C2D_Flush(void);
+
+C3D_RenderTarget *C2D_CreateScreenTarget(int screen, int side);
+void C2D_TargetClear(C3D_RenderTarget *target, u32 color);
+void C2D_SceneBegin(C3D_RenderTarget *target);
+
+bool C2D_DrawRectSolid(float x, float y, float z, float w, float h, u32 clr);
+bool C2D_DrawRectangle(float x, float y, float z, float w, float h, u32 clr0, u32 clr1, u32 clr2, u32 clr3);
+bool C2D_DrawLine(float x0, float y0, u32 clr0, float x1, float y1, u32 clr1, float thickness, float depth);
+bool C2D_DrawImageAt(C2D_Image img, float x, float y, float depth, const C2D_ImageTint *tint, float scaleX,
+                     float scaleY);
+
+C2D_TextBuf C2D_TextBufNew(size_t maxGlyphs);
+void C2D_TextBufDelete(C2D_TextBuf buf);
+void C2D_TextBufClear(C2D_TextBuf buf);
+const char *C2D_TextParse(C2D_Text *text, C2D_TextBuf buf, const char *str);
+const char *C2D_TextFontParse(C2D_Text *text, C2D_Font font, C2D_TextBuf buf, const char *str);
+void C2D_TextOptimize(const C2D_Text *text);
+void C2D_DrawText(const C2D_Text *text, u32 flags, float x, float y, float z, float scaleX, float scaleY, ...);
+
+C2D_Font C2D_FontLoadSystem(CFG_Region region);
+void C2D_FontFree(C2D_Font font);
+
+C2D_SpriteSheet C2D_SpriteSheetLoad(const char *filename);
+void C2D_SpriteSheetFree(C2D_SpriteSheet sheet);
+C2D_Image C2D_SpriteSheetGetImage(C2D_SpriteSheet sheet, size_t index);
+
+#endif
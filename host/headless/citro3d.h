@@ -0,0 +1,28 @@
+#ifndef HEADLESS_CITRO3D_H
+#define HEADLESS_CITRO3D_H
+
+// citro3d as far as the UI uses it (host/headless/3ds.h)
+
+#include <3ds.h>
+#include <math.h>
+
+typedef struct C3D_RenderTarget_tag C3D_RenderTarget;
+
+typedef struct {
+    void *data;
+    u16 width;
+    u16 height;
+} C3D_Tex;
+
+#define C3D_DEFAULT_CMDBUF_SIZE 0x40000
+#define C3D_FRAME_SYNCDRAW      BIT(0)
+
+bool C3D_Init(size_t cmdBufSize);
+void C3D_Fini(void);
+bool C3D_FrameBegin(u8 flags);
+void C3D_FrameEnd(u8 flags);
+float C3D_GetProcessingTime(void);
+float C3D_GetDrawingTime(void);
+float C3D_GetCmdBufUsage(void);
+
+#endif
@@ -0,0 +1,557 @@
+// ============================================================================
+// HEADLESS SESSIONS
+// ============================================================================
+// The whole app (main.c and the windows) on the host with null graphics,
+// driven by an input recording from the console (input.h) or a session
+// script, reporting what each frame cost the main thread in CPU time:
+//
+//   x18headless --replay input.x18i
+//   x18headless --script host/sessions/eq_go_save.txt --mixer 127.0.0.1:10023
+//   x18headless --script session.txt --fast --frames frames.csv
+//
+// Frames are paced at 60 Hz like the console's VBlank unless --fast is given.
+// Only the input is replayed frame for frame. svcGetSystemTick() stays the
+// host clock and the core's threads sleep on real time, so fades, follows,
+// the dead-link confirm, GO verification and console replies depend on
+// thread timing, and --fast changes them (docs/HOST_BUILD.md). The app
+// keeps its files in PLATFORM_DATA_DIR below --dir (default: the current
+// directory) and talks to the mixer in net.txt there, or the one given with
+// --mixer (build_host/x18sim on the same machine).
+//
+// Script syntax, one command per line, '#' starts a comment:
+//
+//   wait N                    N frames without input
+//   press KEY...              The keys down for one frame, then released
+//   hold KEY... N             The keys held for N frames, then released
+//   tap X Y                   Touch for one frame, then released
+//   drag X0 Y0 X1 Y1 N        Touch moving over N frames, then released
+//   repeat N ... end          The enclosed commands N times (nests)
+//
+// Keys: A B X Y L R ZL ZR START SELECT UP DOWN LEFT RIGHT (the D-pad).
+// A released touch reads (0, 0), as on the console.
+//
+// The CPU time counted is the main thread's from aptMainLoop() returning to
+// gspWaitForVBlank(): input, UI logic, OSC sends made inline and the (empty)
+// draw calls. Background threads are in the process total. Host numbers are
+// for comparing builds and options with each other, not with the console.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <citro2d.h>
+#include "platform.h"
+#include "input.h"
+
+#define HEADLESS_FRAME_NS       16683333LL      // 59.94 Hz
+#define HEADLESS_BUDGET_US      16683
+#define HEADLESS_WORST          5
+#define HEADLESS_REPEAT_DEPTH   8
+#define HEADLESS_LINE_MAX       256
+
+int x18_app_main(int argc, char *argv[]);
+
+// ============================================================================
+// NULL GRAPHICS AND SERVICES
+// ============================================================================
+
+struct C3D_RenderTarget_tag { int screen; };
+struct C2D_TextBuf_s { int unused; };
+
+static struct C3D_RenderTarget_tag s_targets[2];
+static struct C2D_TextBuf_s s_text_buf;
+
+void gfxInitDefault(void) {}
+void gfxExit(void) {}
+Result fsInit(void) { return 0; }
+void fsExit(void) {}
+Result romfsInit(void) { return 0; }
+Result romfsExit(void) { return 0; }
+Result socInit(u32 *context_addr, u32 context_size) { (void)context_addr; (void)context_size; return 0; }
+Result socExit(void) { return 0; }
+
+bool C3D_Init(size_t cmdBufSize) { (void)cmdBufSize; return true; }
+void C3D_Fini(void) {}
+bool C3D_FrameBegin(u8 flags) { (void)flags; return true; }
+void C3D_FrameEnd(u8 flags) { (void)flags; }
+float C3D_GetProcessingTime(void) { return 0.0f; }
+float C3D_GetDrawingTime(void) { return 0.0f; }
+float C3D_GetCmdBufUsage(void) { return 0.0f; }
+
+bool C2D_Init(size_t maxObjects) { (void)maxObjects; return true; }
+void C2D_Fini(void) {}
+void C2D_Prepare(void) {}
+void C2D_Flush(void) {}
+
+C3D_RenderTarget *C2D_CreateScreenTarget(int screen, int side)
+{
+    (void)side;
+    s_targets[screen & 1].screen = screen;
+    return &s_targets[screen & 1];
+}
+
+void C2D_TargetClear(C3D_RenderTarget *target, u32 color) { (void)target; (void)color; }
+void C2D_SceneBegin(C3D_RenderTarget *target) { (void)target; }
+
+bool C2D_DrawRectSolid(float x, float y, float z, float w, float h, u32 clr)
+{
+    (void)x; (void)y; (void)z; (void)w; (void)h; (void)clr;
+    return true;
+}
+
+bool C2D_DrawRectangle(float x, float y, float z, float w, float h, u32 clr0, u32 clr1, u32 clr2, u32 clr3)
+{
+    (void)x; (void)y; (void)z; (void)w; (void)h; (void)clr0; (void)clr1; (void)clr2; (void)clr3;
+    return true;
+}
+
+bool C2D_DrawLine(float x0, float y0, u32 clr0, float x1, float y1, u32 clr1, float thickness, float depth)
+{
+    (void)x0; (void)y0; (void)clr0; (void)x1; (void)y1; (void)clr1; (void)thickness; (void)depth;
+    return true;
+}
+
+bool C2D_DrawImageAt(C2D_Image img, float x, float y, float depth, const C2D_ImageTint *tint, float scaleX,
+                     float scaleY)
+{
+    (void)img; (void)x; (void)y; (void)depth; (void)tint; (void)scaleX; (void)scaleY;
+    return true;
+}
+
+C2D_TextBuf C2D_TextBufNew(size_t maxGlyphs) { (void)maxGlyphs; return &s_text_buf; }
+void C2D_TextBufDelete(C2D_TextBuf buf) { (void)buf; }
+void C2D_TextBufClear(C2D_TextBuf buf) { (void)buf; }
+
+const char *C2D_TextFontParse(C2D_Text *text, C2D_Font font, C2D_TextBuf buf, const char *str)
+{
+    memset(text, 0, sizeof(*text));
+    text->buf = buf;
+    text->font = font;
+    text->end = strlen(str);
+    return str + text->end;
+}
+
+const char *C2D_TextParse(C2D_Text *text, C2D_TextBuf buf, const char *str)
+{
+    return C2D_TextFontParse(text, NULL, buf, str);
+}
+
+void C2D_TextOptimize(const C2D_Text *text) { (void)text; }
+
+void C2D_DrawText(const C2D_Text *text, u32 flags, float x, float y, float z, float scaleX, float scaleY, ...)
+{
+    (void)text; (void)flags; (void)x; (void)y; (void)z; (void)scaleX; (void)scaleY;
+}
+
+// No system font or sprite sheets: the UI falls back as on a bare SD card
+C2D_Font C2D_FontLoadSystem(CFG_Region region) { (void)region; return NULL; }
+void C2D_FontFree(C2D_Font font) { (void)font; }
+C2D_SpriteSheet C2D_SpriteSheetLoad(const char *filename) { (void)filename; return NULL; }
+void C2D_SpriteSheetFree(C2D_SpriteSheet sheet) { (void)sheet; }
+
+C2D_Image C2D_SpriteSheetGetImage(C2D_SpriteSheet sheet, size_t index)
+{
+    (void)sheet;
+    (void)index;
+    C2D_Image img = { NULL, NULL };
+    return img;
+}
+
+// ============================================================================
+// FRAME LOOP AND ACCOUNTING
+// ============================================================================
+
+typedef struct {
+    u32 cpu_us;             // Main thread
+    u32 wall_us;
+} FrameSample;
+
+static FrameSample *s_samples = NULL;
+static u32 s_sample_count = 0;
+static u32 s_sample_cap = 0;
+
+static int s_fast = 0;
+static int s_in_frame = 0;
+static s64 s_frame_cpu_ns = 0;
+static s64 s_frame_wall_ns = 0;
+static s64 s_next_vblank_ns = 0;
+
+static s64 clock_ns(clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (s64)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+bool aptMainLoop(void)
+{
+    if (input_source_ended()) return false;
+
+    s_in_frame = 1;
+    s_frame_wall_ns = clock_ns(CLOCK_MONOTONIC);
+    s_frame_cpu_ns = clock_ns(CLOCK_THREAD_CPUTIME_ID);
+    return true;
+}
+
+void gspWaitForVBlank(void)
+{
+    s64 cpu = clock_ns(CLOCK_THREAD_CPUTIME_ID) - s_frame_cpu_ns;
+    s64 now = clock_ns(CLOCK_MONOTONIC);
+
+    // The frame after the source ran out only exists to end the loop
+    if (s_in_frame && !input_source_ended()) {
+        if (s_sample_count == s_sample_cap) {
+            s_sample_cap = s_sample_cap ? s_sample_cap * 2 : 4096;
+            s_samples = realloc(s_samples, s_sample_cap * sizeof(*s_samples));
+        }
+        s_samples[s_sample_count].cpu_us = (u32)(cpu / 1000);
+        s_samples[s_sample_count].wall_us = (u32)((now - s_frame_wall_ns) / 1000);
+        s_sample_count++;
+    }
+    s_in_frame = 0;
+
+    if (s_fast) return;
+    if (s_next_vblank_ns == 0 || now - s_next_vblank_ns > HEADLESS_FRAME_NS) {
+        s_next_vblank_ns = now;     // First frame, or too far behind to catch up
+    }
+    s_next_vblank_ns += HEADLESS_FRAME_NS;
+    s64 wait = s_next_vblank_ns - now;
+    if (wait > 0) svcSleepThread(wait);
+}
+
+// ============================================================================
+// SESSION SCRIPTS
+// ============================================================================
+
+typedef struct {
+    InputFrame *frames;
+    u16 *lines;             // Script line of each frame
+    u32 count;
+    u32 cap;
+    u32 pos;                // Next to play
+} Script;
+
+static Script s_script;
+
+static void script_emit(Script *s, u32 down, u32 held, int tx, int ty, int line)
+{
+    if (s->count == s->cap) {
+        s->cap = s->cap ? s->cap * 2 : 1024;
+        s->frames = realloc(s->frames, s->cap * sizeof(*s->frames));
+        s->lines = realloc(s->lines, s->cap * sizeof(*s->lines));
+    }
+    InputFrame *f = &s->frames[s->count];
+    f->down = down;
+    f->held = held;
+    f->touch_x = (u16)tx;
+    f->touch_y = (u16)ty;
+    s->lines[s->count] = (u16)line;
+    s->count++;
+}
+
+static u32 script_key(const char *name)
+{
+    static const struct { const char *name; u32 mask; } keys[] = {
+        { "A", KEY_A }, { "B", KEY_B }, { "X", KEY_X }, { "Y", KEY_Y },
+        { "L", KEY_L }, { "R", KEY_R }, { "ZL", KEY_ZL }, { "ZR", KEY_ZR },
+        { "START", KEY_START }, { "SELECT", KEY_SELECT },
+        { "UP", KEY_DUP }, { "DOWN", KEY_DDOWN }, { "LEFT", KEY_DLEFT }, { "RIGHT", KEY_DRIGHT },
+    };
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); i++) {
+        if (strcasecmp(name, keys[i].name) == 0) return keys[i].mask;
+    }
+    return 0;
+}
+
+// One command; 0 on a syntax error
+static int script_command(Script *s, int argc, char **argv, int line)
+{
+    const char *cmd = argv[0];
+
+    if (strcmp(cmd, "wait") == 0 && argc == 2) {
+        for (int i = atoi(argv[1]); i > 0; i--) script_emit(s, 0, 0, 0, 0, line);
+        return 1;
+    }
+
+    if ((strcmp(cmd, "press") == 0 && argc >= 2) || (strcmp(cmd, "hold") == 0 && argc >= 3)) {
+        int hold = (cmd[0] == 'h');
+        int frames = hold ? atoi(argv[argc - 1]) : 1;
+        int nkeys = hold ? argc - 2 : argc - 1;
+        u32 mask = 0;
+        for (int i = 1; i <= nkeys; i++) {
+            u32 key = script_key(argv[i]);
+            if (!key) {
+                fprintf(stderr, "line %d: unknown key '%s'\n", line, argv[i]);
+                return 0;
+            }
+            mask |= key;
+        }
+        if (frames < 1) frames = 1;
+        script_emit(s, mask, mask, 0, 0, line);
+        for (int i = 1; i < frames; i++) script_emit(s, 0, mask, 0, 0, line);
+        script_emit(s, 0, 0, 0, 0, line);
+        return 1;
+    }
+
+    if (strcmp(cmd, "tap") == 0 && argc == 3) {
+        script_emit(s, KEY_TOUCH, KEY_TOUCH, atoi(argv[1]), atoi(argv[2]), line);
+        script_emit(s, 0, 0, 0, 0, line);
+        return 1;
+    }
+
+    if (strcmp(cmd, "drag") == 0 && argc == 6) {
+        int x0 = atoi(argv[1]), y0 = atoi(argv[2]);
+        int x1 = atoi(argv[3]), y1 = atoi(argv[4]);
+        int steps = atoi(argv[5]);
+        if (steps < 1) steps = 1;
+        script_emit(s, KEY_TOUCH, KEY_TOUCH, x0, y0, line);
+        for (int i = 1; i <= steps; i++) {
+            script_emit(s, 0, KEY_TOUCH, x0 + (x1 - x0) * i / steps, y0 + (y1 - y0) * i / steps, line);
+        }
+        script_emit(s, 0, 0, 0, 0, line);
+        return 1;
+    }
+
+    fprintf(stderr, "line %d: cannot parse '%s'\n", line, cmd);
+    return 0;
+}
+
+static int script_load(const char *path, Script *s)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return 0;
+    }
+
+    struct { u32 start; int times; int line; } stack[HEADLESS_REPEAT_DEPTH];
+    int depth = 0;
+    int ok = 1;
+    int line = 0;
+    char buf[HEADLESS_LINE_MAX];
+
+    while (ok && fgets(buf, sizeof(buf), f)) {
+        line++;
+        char *hash = strchr(buf, '#');
+        if (hash) *hash = '\0';
+
+        char *argv[8];
+        int argc = 0;
+        for (char *tok = strtok(buf, " \t\r\n"); tok && argc < 8; tok = strtok(NULL, " \t\r\n")) {
+            argv[argc++] = tok;
+        }
+        if (argc == 0) continue;
+
+        if (strcmp(argv[0], "repeat") == 0 && argc == 2) {
+            if (depth == HEADLESS_REPEAT_DEPTH) {
+                fprintf(stderr, "line %d: repeat nested too deep\n", line);
+                ok = 0;
+            } else {
+                stack[depth].start = s->count;
+                stack[depth].times = atoi(argv[1]);
+                stack[depth].line = line;
+                depth++;
+            }
+        } else if (strcmp(argv[0], "end") == 0 && argc == 1) {
+            if (depth == 0) {
+                fprintf(stderr, "line %d: end without repeat\n", line);
+                ok = 0;
+            } else {
+                depth--;
+                u32 start = stack[depth].start;
+                u32 len = s->count - start;
+                // The body has been emitted once; copy it the remaining times
+                for (int i = 1; i < stack[depth].times; i++) {
+                    for (u32 j = 0; j < len; j++) {
+                        InputFrame fr = s->frames[start + j];
+                        script_emit(s, fr.down, fr.held, fr.touch_x, fr.touch_y, s->lines[start + j]);
+                    }
+                }
+                if (stack[depth].times < 1) s->count = start;
+            }
+        } else {
+            ok = script_command(s, argc, argv, line);
+        }
+    }
+    fclose(f);
+
+    if (ok && depth > 0) {
+        fprintf(stderr, "line %d: repeat without end\n", stack[depth - 1].line);
+        ok = 0;
+    }
+    return ok;
+}
+
+// InputSource over the compiled script
+static int script_next(void *ctx, InputFrame *frame)
+{
+    Script *s = ctx;
+    if (s->pos >= s->count) return 0;
+    *frame = s->frames[s->pos++];
+    return 1;
+}
+
+// ============================================================================
+// REPORT
+// ============================================================================
+
+static int compare_u32(const void *a, const void *b)
+{
+    u32 x = *(const u32 *)a, y = *(const u32 *)b;
+    return (x > y) - (x < y);
+}
+
+static void report(s64 process_cpu_ns, s64 wall_ns)
+{
+    u32 n = s_sample_count;
+    if (n == 0) {
+        printf("No frames run\n");
+        return;
+    }
+
+    u32 *sorted = malloc(n * sizeof(u32));
+    u64 total = 0;
+    u32 over = 0;
+    for (u32 i = 0; i < n; i++) {
+        sorted[i] = s_samples[i].cpu_us;
+        total += s_samples[i].cpu_us;
+        if (s_samples[i].wall_us > HEADLESS_BUDGET_US) over++;
+    }
+    qsort(sorted, n, sizeof(u32), compare_u32);
+
+    printf("Frames         %lu in %.1f s%s\n", (unsigned long)n, wall_ns / 1e9, s_fast ? " (--fast)" : "");
+    printf("Main thread    mean %.1f us  p50 %lu  p95 %lu  p99 %lu  max %lu us\n", (double)total / n,
+           (unsigned long)sorted[n / 2], (unsigned long)sorted[(u32)(n * 0.95)],
+           (unsigned long)sorted[(u32)(n * 0.99)], (unsigned long)sorted[n - 1]);
+    printf("Process        %.1f us per frame (all threads, start-up included)\n", process_cpu_ns / 1000.0 / n);
+    printf("Over budget    %lu frames took more than %d us\n", (unsigned long)over, HEADLESS_BUDGET_US);
+
+    // Worst frames, with the script line that fed them
+    u32 floor_us = sorted[n > HEADLESS_WORST ? n - HEADLESS_WORST : 0];
+    int shown = 0;
+    printf("Worst frames\n");
+    for (u32 i = 0; i < n && shown < HEADLESS_WORST; i++) {
+        if (s_samples[i].cpu_us < floor_us) continue;
+        printf("  frame %6lu  %6lu us", (unsigned long)(i + 1), (unsigned long)s_samples[i].cpu_us);
+        if (s_script.count && i < s_script.count) printf("  (line %d)", s_script.lines[i]);
+        printf("\n");
+        shown++;
+    }
+    free(sorted);
+}
+
+static int write_frames_csv(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "%s: cannot create\n", path);
+        return 0;
+    }
+    fprintf(f, "frame,cpu_us,wall_us\n");
+    for (u32 i = 0; i < s_sample_count; i++) {
+        fprintf(f, "%lu,%lu,%lu\n", (unsigned long)(i + 1), (unsigned long)s_samples[i].cpu_us,
+                (unsigned long)s_samples[i].wall_us);
+    }
+    fclose(f);
+    return 1;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+// net.txt as the network window writes it: address line, port line
+static int write_mixer_config(const char *host_port)
+{
+    char host[64];
+    const char *colon = strrchr(host_port, ':');
+    size_t len = colon ? (size_t)(colon - host_port) : strlen(host_port);
+    if (len == 0 || len >= sizeof(host)) return 0;
+    memcpy(host, host_port, len);
+    host[len] = '\0';
+
+    mkdir(PLATFORM_DATA_DIR, 0777);
+    FILE *f = fopen(PLATFORM_DATA_DIR "/net.txt", "w");
+    if (!f) return 0;
+    fprintf(f, "%s\n%s\n", host, colon ? colon + 1 : "10023");
+    fclose(f);
+    return 1;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s (--script FILE | --replay FILE) [--mixer HOST[:PORT]] [--dir DIR] [--fast]\n"
+            "          [--frames CSV]\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *script = NULL, *replay = NULL, *mixer = NULL, *dir = NULL, *csv = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!strcmp(arg, "--fast")) {
+            s_fast = 1;
+        } else if (!strcmp(arg, "--script") && val) {
+            script = val;
+            i++;
+        } else if (!strcmp(arg, "--replay") && val) {
+            replay = val;
+            i++;
+        } else if (!strcmp(arg, "--mixer") && val) {
+            mixer = val;
+            i++;
+        } else if (!strcmp(arg, "--dir") && val) {
+            dir = val;
+            i++;
+        } else if (!strcmp(arg, "--frames") && val) {
+            csv = val;
+            i++;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (!script == !replay) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    // Read the input before --dir moves us away from relative paths
+    if (script) {
+        if (!script_load(script, &s_script)) return 1;
+        input_set_source(script_next, &s_script);
+        printf("Script         %s, %lu frames\n", script, (unsigned long)s_script.count);
+    } else if (!input_replay_open(replay)) {
+        fprintf(stderr, "%s: not an input recording\n", replay);
+        return 1;
+    }
+
+    if (dir && chdir(dir) != 0) {
+        fprintf(stderr, "%s: cannot enter\n", dir);
+        return 1;
+    }
+    if (mixer && !write_mixer_config(mixer)) {
+        fprintf(stderr, "%s: cannot write " PLATFORM_DATA_DIR "/net.txt\n", mixer);
+        return 1;
+    }
+
+    s64 wall_start = clock_ns(CLOCK_MONOTONIC);
+    char *app_argv[] = { argv[0], NULL };
+    x18_app_main(1, app_argv);
+    s64 wall_ns = clock_ns(CLOCK_MONOTONIC) - wall_start;
+
+    report(clock_ns(CLOCK_PROCESS_CPUTIME_ID), wall_ns);
+    if (csv && !write_frames_csv(csv)) return 1;
+
+    free(s_samples);
+    free(s_script.frames);
+    free(s_script.lines);
+    return 0;
+}
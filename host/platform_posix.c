@@ -0,0 +1,260 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+
+#include "platform.h"
+
+struct PosixThread {
+    pthread_t handle;
+    ThreadFunc entry;
+    void *arg;
+};
+
+static __thread Thread t_current = NULL;
+
+// ============================================================================
+// TIME
+// ============================================================================
+
+u64 svcGetSystemTick(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * SYSCLOCK_ARM11 + (u64)ts.tv_nsec * SYSCLOCK_ARM11 / 1000000000ULL;
+}
+
+void svcSleepThread(s64 ns)
+{
+    if (ns <= 0) {
+        sched_yield();
+        return;
+    }
+    struct timespec ts = { (time_t)(ns / 1000000000LL), (long)(ns % 1000000000LL) };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+// Absolute CLOCK_REALTIME deadline for pthread_cond_timedwait
+static struct timespec deadline_after(s64 ns)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += (time_t)(ns / 1000000000LL);
+    ts.tv_nsec += (long)(ns % 1000000000LL);
+    if (ts.tv_nsec >= 1000000000L) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+    }
+    return ts;
+}
+
+// ============================================================================
+// THREADS
+// ============================================================================
+
+static void *thread_trampoline(void *arg)
+{
+    Thread t = (Thread)arg;
+    t_current = t;
+    t->entry(t->arg);
+    return NULL;
+}
+
+Thread threadCreate(ThreadFunc entrypoint, void *arg, size_t stack_size, int prio, int core_id, bool detached)
+{
+    (void)prio;
+    (void)core_id;
+    Thread t = (Thread)calloc(1, sizeof(*t));
+    if (!t) return NULL;
+    t->entry = entrypoint;
+    t->arg = arg;
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    // Host stacks are never smaller than the 3DS ones
+    if (stack_size < PTHREAD_STACK_MIN) stack_size = PTHREAD_STACK_MIN;
+    pthread_attr_setstacksize(&attr, stack_size + 64 * 1024);
+    if (detached) pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    int rc = pthread_create(&t->handle, &attr, thread_trampoline, t);
+    pthread_attr_destroy(&attr);
+    if (rc != 0) {
+        free(t);
+        return NULL;
+    }
+    return t;
+}
+
+Result threadJoin(Thread thread, u64 timeout_ns)
+{
+    (void)timeout_ns;
+    if (!thread) return -1;
+    return pthread_join(thread->handle, NULL) == 0 ? 0 : -1;
+}
+
+void threadFree(Thread thread)
+{
+    free(thread);
+}
+
+Thread threadGetCurrent(void)
+{
+    return t_current;
+}
+
+Result svcGetThreadPriority(s32 *out, Handle handle)
+{
+    (void)handle;
+    *out = 0x30;
+    return 0;
+}
+
+void LightLock_Init(LightLock *lock)
+{
+    pthread_mutex_init(&lock->mutex, NULL);
+}
+
+void LightLock_Lock(LightLock *lock)
+{
+    pthread_mutex_lock(&lock->mutex);
+}
+
+int LightLock_TryLock(LightLock *lock)
+{
+    return pthread_mutex_trylock(&lock->mutex) == 0 ? 0 : 1;
+}
+
+void LightLock_Unlock(LightLock *lock)
+{
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+void LightEvent_Init(LightEvent *event, ResetType reset_type)
+{
+    pthread_mutex_init(&event->mutex, NULL);
+    pthread_cond_init(&event->cond, NULL);
+    event->signaled = 0;
+    event->reset_type = reset_type;
+}
+
+void LightEvent_Clear(LightEvent *event)
+{
+    pthread_mutex_lock(&event->mutex);
+    event->signaled = 0;
+    pthread_mutex_unlock(&event->mutex);
+}
+
+void LightEvent_Signal(LightEvent *event)
+{
+    pthread_mutex_lock(&event->mutex);
+    if (event->reset_type == RESET_PULSE) {
+        pthread_cond_broadcast(&event->cond);
+    } else {
+        event->signaled = 1;
+        if (event->reset_type == RESET_ONESHOT) pthread_cond_signal(&event->cond);
+        else pthread_cond_broadcast(&event->cond);
+    }
+    pthread_mutex_unlock(&event->mutex);
+}
+
+// Mutex held
+static void consume(LightEvent *event)
+{
+    if (event->reset_type == RESET_ONESHOT) event->signaled = 0;
+}
+
+void LightEvent_Wait(LightEvent *event)
+{
+    pthread_mutex_lock(&event->mutex);
+    while (!event->signaled) {
+        pthread_cond_wait(&event->cond, &event->mutex);
+        if (event->reset_type == RESET_PULSE) break;
+    }
+    consume(event);
+    pthread_mutex_unlock(&event->mutex);
+}
+
+int LightEvent_WaitTimeout(LightEvent *event, s64 timeout_ns)
+{
+    struct timespec deadline = deadline_after(timeout_ns);
+    int timed_out = 0;
+
+    pthread_mutex_lock(&event->mutex);
+    while (!event->signaled) {
+        if (pthread_cond_timedwait(&event->cond, &event->mutex, &deadline) == ETIMEDOUT) {
+            timed_out = 1;
+            break;
+        }
+        if (event->reset_type == RESET_PULSE) break;
+    }
+    if (!timed_out) consume(event);
+    pthread_mutex_unlock(&event->mutex);
+    return timed_out;
+}
+
+int LightEvent_TryWait(LightEvent *event)
+{
+    pthread_mutex_lock(&event->mutex);
+    int signaled = event->signaled;
+    if (signaled) consume(event);
+    pthread_mutex_unlock(&event->mutex);
+    return signaled;
+}
+
+// ============================================================================
+// PLATFORM
+// ============================================================================
+
+void platform_init(void)
+{
+}
+
+void platform_exit(void)
+{
+}
+
+int platform_network_up(void)
+{
+    u32 ip, mask;
+    return platform_local_subnet(&ip, &mask);
+}
+
+// First IPv4 interface that is up and not loopback
+int platform_local_subnet(u32 *ip, u32 *mask)
+{
+    struct ifaddrs *list;
+    *ip = 0;
+    *mask = 0;
+    if (getifaddrs(&list) != 0) return 0;
+
+    for (struct ifaddrs *ifa = list; ifa; ifa = ifa->ifa_next) {
+        if (!ifa->ifa_addr || ifa->ifa_addr->sa_family != AF_INET || !ifa->ifa_netmask) continue;
+        if (!(ifa->ifa_flags & IFF_UP) || (ifa->ifa_flags & IFF_LOOPBACK)) continue;
+        *ip = ntohl(((struct sockaddr_in *)ifa->ifa_addr)->sin_addr.s_addr);
+        *mask = ntohl(((struct sockaddr_in *)ifa->ifa_netmask)->sin_addr.s_addr);
+        break;
+    }
+    freeifaddrs(list);
+    return *ip != 0;
+}
+
+// No sleep / HOME menu on the host
+void platform_on_resume(void (*callback)(void))
+{
+    (void)callback;
+}
+
+// No buttons on the host: input comes from a replay or script (input.h)
+void platform_input_read(u32 *down, u32 *held, u16 *touch_x, u16 *touch_y)
+{
+    *down = 0;
+    *held = 0;
+    *touch_x = 0;
+    *touch_y = 0;
+}
@@ -0,0 +1,87 @@
+#ifndef PLATFORM_POSIX_H
+#define PLATFORM_POSIX_H
+
+// ============================================================================
+// HOST PLATFORM (POSIX)
+// ============================================================================
+// The libctru subset the core uses (see src/platform.h), on pthreads and
+// CLOCK_MONOTONIC. Only included by the host build. System ticks run at the
+// 3DS's SYSCLOCK_ARM11 rate so tick arithmetic in the core is unchanged.
+// Thread priorities and cores are accepted and ignored.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+typedef s32 Result;
+typedef u32 Handle;
+
+#define BIT(n)              (1U << (n))
+#define U64_MAX             UINT64_MAX
+#define R_SUCCEEDED(res)    ((res) >= 0)
+#define R_FAILED(res)       ((res) < 0)
+#define CUR_THREAD_HANDLE   0xFFFF8000
+
+// ============================================================================
+// TIME
+// ============================================================================
+
+#define SYSCLOCK_ARM11      268111856ULL
+#define CPU_TICKS_PER_MSEC  (SYSCLOCK_ARM11 / 1000.0)
+#define CPU_TICKS_PER_USEC  (SYSCLOCK_ARM11 / 1000000.0)
+
+u64 svcGetSystemTick(void);
+void svcSleepThread(s64 ns);
+
+// ============================================================================
+// THREADS
+// ============================================================================
+
+typedef void (*ThreadFunc)(void *);
+typedef struct PosixThread *Thread;
+
+Thread threadCreate(ThreadFunc entrypoint, void *arg, size_t stack_size, int prio, int core_id, bool detached);
+Result threadJoin(Thread thread, u64 timeout_ns);
+void threadFree(Thread thread);
+Thread threadGetCurrent(void);      // NULL on the main thread, as on the 3DS
+Result svcGetThreadPriority(s32 *out, Handle handle);
+
+typedef struct {
+    pthread_mutex_t mutex;
+} LightLock;
+
+void LightLock_Init(LightLock *lock);
+void LightLock_Lock(LightLock *lock);
+int LightLock_TryLock(LightLock *lock);     // 0 if taken
+void LightLock_Unlock(LightLock *lock);
+
+typedef enum {
+    RESET_ONESHOT = 0,
+    RESET_STICKY = 1,
+    RESET_PULSE = 2
+} ResetType;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int signaled;
+    ResetType reset_type;
+} LightEvent;
+
+void LightEvent_Init(LightEvent *event, ResetType reset_type);
+void LightEvent_Clear(LightEvent *event);
+void LightEvent_Signal(LightEvent *event);
+void LightEvent_Wait(LightEvent *event);
+int LightEvent_WaitTimeout(LightEvent *event, s64 timeout_ns);     // 1 on timeout
+int LightEvent_TryWait(LightEvent *event);                          // 1 if signaled
+
+#endif
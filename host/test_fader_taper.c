@@ -0,0 +1,114 @@
+// ============================================================================
+// FADER TAPER TEST
+// ============================================================================
+// Checks src/fader_taper.c against the console's calibration points and
+// itself (Makefile.host test):
+//
+//   test_fader_taper [FILE]          FILE defaults to docs/Valori_Fader.txt
+//
+// Every "valore N = XdB" line (N = fader position in percent) must map to
+// X dB within TAPER_TOLERANCE_DB: the points are rounded to whole percent,
+// which is up to 1.2 dB in the -30 .. -10 segment. Then every step must
+// match the 4-segment law in fader_taper.h to Q8.8 precision and survive
+// step -> dB -> step unchanged. Exits 1 on any failure.
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "platform.h"
+#include "fader_taper.h"
+
+#define TAPER_POINTS_PATH   "docs/Valori_Fader.txt"
+#define TAPER_TOLERANCE_DB  1.5f
+
+static int s_failures = 0;
+
+static void fail(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    printf("FAIL  ");
+    vprintf(fmt, args);
+    printf("\n");
+    va_end(args);
+    s_failures++;
+}
+
+// The console's law, written out independently of fader_taper.c
+static float law_db(int step)
+{
+    float f = step / (float)(FADER_STEPS - 1);
+    if (f >= 0.5f) return 40.0f * f - 30.0f;
+    if (f >= 0.25f) return 80.0f * f - 50.0f;
+    if (f >= 0.0625f) return 160.0f * f - 70.0f;
+    return 480.0f * f - 90.0f;
+}
+
+// Calibration points; returns how many were checked
+static int check_points(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        printf("FAIL  cannot open %s\n", path);
+        s_failures++;
+        return 0;
+    }
+
+    int checked = 0;
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        int percent;
+        char db_text[32];
+        if (sscanf(line, "valore %d = %31s", &percent, db_text) != 2) continue;
+
+        int step = fader_value_to_step(percent / 100.0f);
+        float db = fader_step_to_db(step);
+        checked++;
+
+        if (strncmp(db_text, "-inf", 4) == 0) {
+            if (!isinf(db) || db > 0) fail("valore %d: %.2f dB, expected -inf", percent, db);
+            continue;
+        }
+        float expected = strtof(db_text, NULL);
+        if (fabsf(db - expected) > TAPER_TOLERANCE_DB) {
+            fail("valore %d: %.2f dB, expected %.0f dB", percent, db, expected);
+        }
+    }
+    fclose(f);
+
+    if (checked == 0) {
+        printf("FAIL  no calibration points in %s\n", path);
+        s_failures++;
+    }
+    return checked;
+}
+
+static void check_round_trip(void)
+{
+    if (fader_db_to_step(fader_step_to_db(0)) != 0) fail("step 0: -inf does not map back to step 0");
+
+    for (int step = 1; step < FADER_STEPS; step++) {
+        float db = fader_step_to_db(step);
+        int back = fader_db_to_step(db);
+        if (back != step) fail("step %d: %.3f dB maps back to step %d", step, db, back);
+
+        float expected = law_db(step);
+        if (fabsf(db - expected) > 1.0f / 256.0f) fail("step %d: %.4f dB, law gives %.4f dB", step, db, expected);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : TAPER_POINTS_PATH;
+
+    fader_taper_init();
+    int points = check_points(path);
+    check_round_trip();
+
+    printf("fader_taper: %d calibration points, %d steps round-tripped, %d failures\n", points, FADER_STEPS,
+           s_failures);
+    return s_failures ? 1 : 0;
+}
@@ -0,0 +1,382 @@
+// ============================================================================
+// CAPTURE SUMMARY AND REPLAY
+// ============================================================================
+// Reads a capture file written by src/osc_capture.c and either summarises
+// it or sends its packets to a UDP listener (build_host/x18sim, or a real
+// console) with the original spacing, faster, or back to back:
+//
+//   x18replay capture.x18c                      Summary only
+//   x18replay --to 127.0.0.1:10023 capture.x18c          Original speed
+//   x18replay --to 127.0.0.1:10023 --speed 4 capture.x18c
+//   x18replay --to 127.0.0.1:10023 --speed 0 capture.x18c   No waiting
+//
+// By default only what the app sent to the mixer is replayed; --link picks
+// another link (0 = mixer, 1-3 = fan-out targets, 7 = control port) and
+// --inbound the packets received on it instead.
+//
+// The summary counts packets per link and direction and splits the sends
+// to the mixer into bursts (GOs, fades, drags) separated by --gap ms of
+// silence, so two captures of the same show made with different send
+// options (pacing, skip_unchanged, snap_offload) can be compared.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "platform.h"
+#include "osc_capture.h"
+
+#define REPLAY_DEFAULT_PORT     10023
+#define REPLAY_DEFAULT_GAP_MS   100
+#define REPLAY_LINKS            (CAPTURE_LINK_MASK + 1)
+#define REPLAY_ADDR_MAX         48
+
+typedef struct {
+    u64 tick;               // Since the first record
+    u8 flags;
+    u8 len;
+    const u8 *data;
+} Packet;
+
+typedef struct {
+    Packet *packets;
+    int count;
+    u32 ticks_per_sec;
+    u8 *raw;
+} Capture;
+
+// ============================================================================
+// FILE
+// ============================================================================
+
+static u64 get_le(const u8 *p, int bytes)
+{
+    u64 v = 0;
+    for (int i = bytes - 1; i >= 0; i--) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+// LEB128; 0 when it runs off the end
+static int get_varint(const u8 *p, long avail, u64 *out)
+{
+    u64 v = 0;
+    for (int n = 0; n < 10 && n < avail; n++) {
+        v |= (u64)(p[n] & 0x7F) << (7 * n);
+        if (!(p[n] & 0x80)) {
+            *out = v;
+            return n + 1;
+        }
+    }
+    return 0;
+}
+
+static int capture_load(const char *path, Capture *cap)
+{
+    memset(cap, 0, sizeof(*cap));
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return 0;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    cap->raw = (u8 *)malloc(size > 0 ? size : 1);
+    if (!cap->raw || fread(cap->raw, 1, size, f) != (size_t)size) {
+        fprintf(stderr, "%s: read failed\n", path);
+        fclose(f);
+        return 0;
+    }
+    fclose(f);
+
+    const u8 *p = cap->raw;
+    if (size < CAPTURE_HEADER_SIZE || memcmp(p, CAPTURE_MAGIC, 4) != 0) {
+        fprintf(stderr, "%s: not a capture file\n", path);
+        return 0;
+    }
+    if (p[4] != CAPTURE_VERSION) {
+        fprintf(stderr, "%s: capture version %d, expected %d\n", path, p[4], CAPTURE_VERSION);
+        return 0;
+    }
+    cap->ticks_per_sec = (u32)get_le(p + 8, 4);
+    if (cap->ticks_per_sec == 0) cap->ticks_per_sec = SYSCLOCK_ARM11;
+
+    // Upper bound: every record is at least 3 bytes
+    cap->packets = (Packet *)malloc(sizeof(Packet) * (size / 3 + 1));
+    if (!cap->packets) return 0;
+
+    long pos = CAPTURE_HEADER_SIZE;
+    u64 tick = 0;
+    while (pos < size) {
+        u64 delta, len;
+        u8 flags = p[pos];
+        int n1 = get_varint(p + pos + 1, size - pos - 1, &delta);
+        int n2 = n1 ? get_varint(p + pos + 1 + n1, size - pos - 1 - n1, &len) : 0;
+        long data = pos + 1 + n1 + n2;
+        if (!n2 || len > CAPTURE_PACKET_MAX || data + (long)len > size) {
+            // The app was stopped while writing: keep what is complete
+            fprintf(stderr, "%s: truncated record at byte %ld, %d packets read\n", path, pos, cap->count);
+            break;
+        }
+        tick += delta;
+        Packet *pk = &cap->packets[cap->count++];
+        pk->tick = tick;
+        pk->flags = flags;
+        pk->len = (u8)len;
+        pk->data = p + data;
+        pos = data + (long)len;
+    }
+    return 1;
+}
+
+static int packet_link(const Packet *pk)
+{
+    return (pk->flags >> CAPTURE_LINK_SHIFT) & CAPTURE_LINK_MASK;
+}
+
+static int packet_inbound(const Packet *pk)
+{
+    return (pk->flags & CAPTURE_FLAG_INBOUND) != 0;
+}
+
+static double tick_ms(const Capture *cap, u64 ticks)
+{
+    return (double)ticks * 1000.0 / (double)cap->ticks_per_sec;
+}
+
+// ============================================================================
+// SUMMARY
+// ============================================================================
+
+static const char *link_name(int link)
+{
+    static char name[16];
+    if (link == CAPTURE_LINK_MIXER) return "mixer";
+    if (link == CAPTURE_LINK_CONTROL) return "control";
+    snprintf(name, sizeof(name), "target %d", link);
+    return name;
+}
+
+static void summarize(const Capture *cap, int link, int inbound, u32 gap_ms, int verbose)
+{
+    u32 packets[REPLAY_LINKS][2];
+    u64 bytes[REPLAY_LINKS][2];
+    u32 truncated = 0;
+    memset(packets, 0, sizeof(packets));
+    memset(bytes, 0, sizeof(bytes));
+
+    for (int i = 0; i < cap->count; i++) {
+        const Packet *pk = &cap->packets[i];
+        packets[packet_link(pk)][packet_inbound(pk)]++;
+        bytes[packet_link(pk)][packet_inbound(pk)] += pk->len;
+        if (pk->flags & CAPTURE_FLAG_TRUNCATED) truncated++;
+    }
+
+    double duration = cap->count ? tick_ms(cap, cap->packets[cap->count - 1].tick) / 1000.0 : 0.0;
+    printf("%d packets over %.1f s", cap->count, duration);
+    if (truncated) printf(" (%lu truncated to %d bytes)", (unsigned long)truncated, CAPTURE_PACKET_MAX);
+    printf("\n\n%-10s %10s %10s %10s %10s\n", "link", "sent", "bytes", "received", "bytes");
+    for (int l = 0; l < REPLAY_LINKS; l++) {
+        if (!packets[l][0] && !packets[l][1]) continue;
+        printf("%-10s %10lu %10llu %10lu %10llu\n", link_name(l), (unsigned long)packets[l][0],
+               (unsigned long long)bytes[l][0], (unsigned long)packets[l][1], (unsigned long long)bytes[l][1]);
+    }
+
+    // Bursts of the selected stream, and its busiest second
+    u64 gap = (u64)gap_ms * cap->ticks_per_sec / 1000;
+    u32 bursts = 0, burst_packets = 0, max_packets = 0, peak_second = 0;
+    double total_ms = 0.0, max_ms = 0.0;
+    u64 burst_start = 0, last = 0;
+    int window_start = 0;
+    u32 in_window = 0;
+    char first_addr[REPLAY_ADDR_MAX] = "";
+
+    if (verbose) printf("\n%6s %10s %8s %10s  %s\n", "burst", "at (s)", "packets", "ms", "first address");
+    for (int i = 0; i <= cap->count; i++) {
+        const Packet *pk = (i < cap->count) ? &cap->packets[i] : NULL;
+        if (pk && (packet_link(pk) != link || packet_inbound(pk) != inbound)) continue;
+
+        if (burst_packets && (!pk || pk->tick - last > gap)) {
+            double ms = tick_ms(cap, last - burst_start);
+            bursts++;
+            total_ms += ms;
+            if (ms > max_ms) max_ms = ms;
+            if (burst_packets > max_packets) max_packets = burst_packets;
+            if (verbose) {
+                printf("%6lu %10.3f %8lu %10.1f  %s\n", (unsigned long)bursts, tick_ms(cap, burst_start) / 1000.0,
+                       (unsigned long)burst_packets, ms, first_addr);
+            }
+            burst_packets = 0;
+        }
+        if (!pk) break;
+
+        if (!burst_packets) {
+            burst_start = pk->tick;
+            snprintf(first_addr, sizeof(first_addr), "%.*s", (int)strnlen((const char *)pk->data, pk->len),
+                     (const char *)pk->data);
+        }
+        burst_packets++;
+        last = pk->tick;
+
+        // Selected packets in the second up to this one
+        in_window++;
+        while (window_start < i) {
+            const Packet *w = &cap->packets[window_start];
+            int selected = packet_link(w) == link && packet_inbound(w) == inbound;
+            if (selected && pk->tick - w->tick < cap->ticks_per_sec) break;
+            if (selected) in_window--;
+            window_start++;
+        }
+        if (in_window > peak_second) peak_second = in_window;
+    }
+
+    printf("\n%s %s: %lu bursts (gap %lu ms), mean %.1f ms, longest %.1f ms, largest %lu packets, peak %lu packets/s\n",
+           link_name(link), inbound ? "received" : "sent", (unsigned long)bursts, (unsigned long)gap_ms,
+           bursts ? total_ms / bursts : 0.0, max_ms, (unsigned long)max_packets, (unsigned long)peak_second);
+}
+
+// ============================================================================
+// REPLAY
+// ============================================================================
+
+static u64 now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000ULL + (u64)ts.tv_nsec;
+}
+
+static void sleep_until(u64 deadline)
+{
+    for (;;) {
+        u64 now = now_ns();
+        if (now >= deadline) return;
+        u64 wait = deadline - now;
+        struct timespec ts = { (time_t)(wait / 1000000000ULL), (long)(wait % 1000000000ULL) };
+        nanosleep(&ts, NULL);
+    }
+}
+
+static int replay(const Capture *cap, const char *to, int link, int inbound, double speed)
+{
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(REPLAY_DEFAULT_PORT);
+
+    char host[32];
+    snprintf(host, sizeof(host), "%s", to);
+    char *colon = strchr(host, ':');
+    if (colon) {
+        *colon = '\0';
+        addr.sin_port = htons((u16)atoi(colon + 1));
+    }
+    if (inet_pton(AF_INET, host, &addr.sin_addr) <= 0) {
+        fprintf(stderr, "bad address %s\n", to);
+        return 0;
+    }
+
+    int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0) {
+        perror("socket");
+        return 0;
+    }
+
+    u32 sent = 0, errors = 0;
+    u64 max_late = 0, first_tick = 0;
+    int have_first = 0;
+    u64 start = now_ns();
+    for (int i = 0; i < cap->count; i++) {
+        const Packet *pk = &cap->packets[i];
+        if (packet_link(pk) != link || packet_inbound(pk) != inbound) continue;
+        if (!have_first) {
+            first_tick = pk->tick;
+            have_first = 1;
+        }
+
+        if (speed > 0.0) {
+            u64 due = start + (u64)(tick_ms(cap, pk->tick - first_tick) * 1e6 / speed);
+            sleep_until(due);
+            u64 late = now_ns() - due;
+            if (late > max_late) max_late = late;
+        }
+        if (sendto(fd, pk->data, pk->len, 0, (struct sockaddr *)&addr, sizeof(addr)) == pk->len) sent++;
+        else errors++;
+    }
+    double elapsed = (double)(now_ns() - start) / 1e9;
+    close(fd);
+
+    printf("\nReplayed %lu packets to %s in %.3f s", (unsigned long)sent, to, elapsed);
+    if (speed > 0.0) printf(" (x%.2f, latest send %.2f ms behind)", speed, (double)max_late / 1e6);
+    if (errors) printf(", %lu send errors", (unsigned long)errors);
+    printf("\n");
+    return errors == 0;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [--to HOST[:PORT]] [--speed X] [--link N] [--inbound] [--gap MS] [-v] FILE\n"
+            "  --speed 1 replays with the original spacing (default), 0 without waiting\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *to = NULL, *path = NULL;
+    double speed = 1.0;
+    int link = CAPTURE_LINK_MIXER, inbound = 0, verbose = 0;
+    u32 gap_ms = REPLAY_DEFAULT_GAP_MS;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!strcmp(arg, "-v")) {
+            verbose = 1;
+        } else if (!strcmp(arg, "--inbound")) {
+            inbound = 1;
+        } else if (!strcmp(arg, "--to") && val) {
+            to = val;
+            i++;
+        } else if (!strcmp(arg, "--speed") && val) {
+            speed = atof(val);
+            i++;
+        } else if (!strcmp(arg, "--link") && val) {
+            link = atoi(val) & CAPTURE_LINK_MASK;
+            i++;
+        } else if (!strcmp(arg, "--gap") && val) {
+            gap_ms = (u32)atoi(val);
+            i++;
+        } else if (arg[0] != '-' && !path) {
+            path = arg;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (!path) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    Capture cap;
+    if (!capture_load(path, &cap)) return 1;
+    summarize(&cap, link, inbound, gap_ms, verbose);
+
+    int ok = 1;
+    if (to) ok = replay(&cap, to, link, inbound, speed);
+
+    free(cap.packets);
+    free(cap.raw);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,639 @@
+// ============================================================================
+// X18 STAND-IN
+// ============================================================================
+// A UDP server that answers like an XR18, so every network feature of the
+// app can be tested end to end on one Linux machine. The parameter tree is
+// the app's own registry (param.h), so it covers exactly what the app sends.
+//
+//   set      /ch/01/mix/fader ,f 0.75     Stored as a registry step
+//   query    /ch/01/mix/fader             Answered with the stored value
+//   /xinfo, /status                       Console identity
+//   /xremote                              10 s of feedback: every set from
+//                                         another client is echoed
+//   /meters ,s /meters/1                  10 s of /meters/1 blobs, 50 ms apart
+//   /-snap/save ,i N   /-snap/load ,i N   64 snapshot slots (name, index)
+//
+// Impairments apply to both directions independently (latency is one way):
+//
+//   --loss PCT        Drop packets
+//   --latency MS      Delay every packet
+//   --jitter MS       Plus a uniform random delay
+//   --reorder PCT     Hold packets back past the ones that follow
+//
+// Once a second it logs throughput, and after each GO (a burst of sets
+// following SIM_GO_GAP_MS of silence) how many sets it carried and how long
+// it took from the first to the last.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "platform.h"
+#include "param.h"
+#include "fader_taper.h"
+#include "xair_codec.h"
+
+#define SIM_DEFAULT_PORT    10023
+#define SIM_PACKET_MAX      1500
+#define SIM_CLIENTS         8
+#define SIM_SUBSCRIBE_MS    10000   // /xremote and /meters last this long, as on the console
+#define SIM_METERS_MS       50
+#define SIM_METERS_COUNT    40      // /meters/1: 16 inputs, aux, fx returns, buses, LR
+#define SIM_SNAP_SLOTS      64
+#define SIM_STRING_MAX      32
+#define SIM_DELAY_QUEUE     4096
+#define SIM_GO_GAP_MS       100
+#define SIM_ID_SPACE        0x10000
+
+typedef struct {
+    struct sockaddr_in addr;
+    u64 xremote_until;      // ns, 0 = not subscribed
+    u64 meters_until;
+    u64 meters_next;
+} Client;
+
+typedef struct {
+    u16 *steps;             // SIM_ID_SPACE entries, NULL = empty slot
+    char (*strings)[SIM_STRING_MAX];
+    char name[SIM_STRING_MAX];
+} Snapshot;
+
+typedef struct {
+    u64 due;
+    int inbound;            // 1 = to be handled, 0 = to be sent
+    struct sockaddr_in addr;
+    int len;
+    u8 data[SIM_PACKET_MAX];
+} Delayed;
+
+typedef struct {
+    double loss;            // 0..1
+    double reorder;
+    u32 latency_ms;
+    u32 jitter_ms;
+} Impairment;
+
+static int s_fd = -1;
+static volatile sig_atomic_t s_exit = 0;
+static int s_verbose = 0;
+static char s_name[SIM_STRING_MAX] = "XR18-SIM";
+static char s_ip[16] = "127.0.0.1";
+
+static u16 s_steps[SIM_ID_SPACE];
+static char s_strings[SIM_ID_SPACE][SIM_STRING_MAX];
+static Snapshot s_snaps[SIM_SNAP_SLOTS];
+static int s_snap_index = 0;
+
+static Client s_clients[SIM_CLIENTS];
+static Impairment s_imp;
+static Delayed *s_queue[SIM_DELAY_QUEUE];
+static int s_queued = 0;
+
+// Counters for the current second, and since start
+static struct {
+    u32 in, out, sets, queries, dropped;
+} s_second;
+static u64 s_total_in = 0, s_total_out = 0, s_total_dropped = 0;
+
+// GO in progress
+static u64 s_go_first = 0, s_go_last = 0;
+static u32 s_go_sets = 0, s_go_count = 0;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static u64 now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000ULL + (u64)ts.tv_nsec;
+}
+
+static u64 s_start_ns = 0;
+
+static double since_start_s(u64 ns)
+{
+    return (double)(ns - s_start_ns) / 1e9;
+}
+
+static double rand_unit(void)
+{
+    return (double)rand() / ((double)RAND_MAX + 1.0);
+}
+
+static int pad4(int n)
+{
+    return (n + 4) & ~3;
+}
+
+static void put_be32(u8 *p, u32 v)
+{
+    p[0] = (u8)(v >> 24);
+    p[1] = (u8)(v >> 16);
+    p[2] = (u8)(v >> 8);
+    p[3] = (u8)v;
+}
+
+static int put_string(u8 *buf, int pos, int max, const char *s)
+{
+    int len = (int)strlen(s);
+    int padded = pad4(len);
+    if (pos + padded > max) return -1;
+    memset(buf + pos, 0, padded);
+    memcpy(buf + pos, s, len);
+    return pos + padded;
+}
+
+// String at pos (NUL-terminated, padded); NULL if it runs off the packet
+static const char *get_string(const u8 *packet, int len, int *pos)
+{
+    int end = *pos;
+    while (end < len && packet[end] != 0) end++;
+    if (end >= len) return NULL;
+    const char *s = (const char *)packet + *pos;
+    *pos += pad4(end - *pos);
+    return s;
+}
+
+static const char *addr_text(const struct sockaddr_in *addr)
+{
+    static char text[32];
+    snprintf(text, sizeof(text), "%s:%d", inet_ntoa(addr->sin_addr), ntohs(addr->sin_port));
+    return text;
+}
+
+static int same_addr(const struct sockaddr_in *a, const struct sockaddr_in *b)
+{
+    return a->sin_addr.s_addr == b->sin_addr.s_addr && a->sin_port == b->sin_port;
+}
+
+// ============================================================================
+// IMPAIRED DELIVERY
+// ============================================================================
+
+// Through the impairment: dropped, delayed or delivered now. Returns 1 when
+// the caller should handle (inbound) or send (outbound) it right away.
+static int impair(int inbound, const struct sockaddr_in *addr, const u8 *data, int len)
+{
+    if (s_imp.loss > 0.0 && rand_unit() < s_imp.loss) {
+        s_second.dropped++;
+        s_total_dropped++;
+        return 0;
+    }
+
+    u64 delay_ms = s_imp.latency_ms;
+    if (s_imp.jitter_ms) delay_ms += (u64)(rand_unit() * s_imp.jitter_ms);
+    if (s_imp.reorder > 0.0 && rand_unit() < s_imp.reorder) {
+        // Long enough for the next few packets to overtake it
+        delay_ms += 2 + s_imp.jitter_ms + s_imp.latency_ms / 2;
+    }
+    if (delay_ms == 0) return 1;
+
+    if (s_queued >= SIM_DELAY_QUEUE || len > SIM_PACKET_MAX) {
+        s_second.dropped++;
+        s_total_dropped++;
+        return 0;
+    }
+    Delayed *d = (Delayed *)malloc(sizeof(Delayed));
+    if (!d) return 0;
+    d->due = now_ns() + delay_ms * 1000000ULL;
+    d->inbound = inbound;
+    d->addr = *addr;
+    d->len = len;
+    memcpy(d->data, data, len);
+    s_queue[s_queued++] = d;
+    return 0;
+}
+
+static void send_raw(const struct sockaddr_in *to, const u8 *data, int len)
+{
+    if (sendto(s_fd, data, len, 0, (const struct sockaddr *)to, sizeof(*to)) == len) {
+        s_second.out++;
+        s_total_out++;
+    }
+}
+
+static void reply(const struct sockaddr_in *to, const u8 *data, int len)
+{
+    if (impair(0, to, data, len)) send_raw(to, data, len);
+}
+
+// ============================================================================
+// CLIENTS AND FEEDBACK
+// ============================================================================
+
+static Client *client_for(const struct sockaddr_in *addr, u64 now)
+{
+    Client *free_slot = NULL;
+    for (int i = 0; i < SIM_CLIENTS; i++) {
+        Client *c = &s_clients[i];
+        if (c->xremote_until > now || c->meters_until > now) {
+            if (same_addr(&c->addr, addr)) return c;
+        } else if (!free_slot) {
+            free_slot = c;
+        }
+    }
+    if (free_slot) {
+        memset(free_slot, 0, sizeof(*free_slot));
+        free_slot->addr = *addr;
+    }
+    return free_slot;
+}
+
+// A change made by `from` goes to every other /xremote subscriber
+static void feedback(const struct sockaddr_in *from, const u8 *packet, int len, u64 now)
+{
+    for (int i = 0; i < SIM_CLIENTS; i++) {
+        Client *c = &s_clients[i];
+        if (c->xremote_until > now && !same_addr(&c->addr, from)) reply(&c->addr, packet, len);
+    }
+}
+
+// /meters/1: blob of little-endian s16 levels (dB in 1/256), inputs follow
+// their fader position
+static void send_meters(Client *c)
+{
+    u8 packet[128];
+    int pos = put_string(packet, 0, sizeof(packet), "/meters/1");
+    pos = put_string(packet, pos, sizeof(packet), ",b");
+    int blob_len = 4 + SIM_METERS_COUNT * 2;
+    put_be32(packet + pos, (u32)blob_len);
+    pos += 4;
+    u8 *blob = packet + pos;
+    blob[0] = SIM_METERS_COUNT;
+    blob[1] = blob[2] = blob[3] = 0;
+    for (int i = 0; i < SIM_METERS_COUNT; i++) {
+        s16 level = -32768;
+        if (i < 16 && s_steps[PARAM_ID(PT_CH_MIX_ON, i, 0)]) {
+            level = fader_step_to_db_q8(s_steps[PARAM_ID(PT_CH_MIX_FADER, i, 0)]);
+            if (level != FADER_DB_Q8_OFF) level = (s16)(level - 12 * 256 - (rand() & 0x3FF));
+        }
+        blob[4 + i * 2] = (u8)(level & 0xFF);
+        blob[5 + i * 2] = (u8)((u16)level >> 8);
+    }
+    reply(&c->addr, packet, pos + blob_len);
+}
+
+// ============================================================================
+// PARAMETER TREE
+// ============================================================================
+
+static void tree_init(void)
+{
+    for (u32 id = 0; id < SIM_ID_SPACE; id++) {
+        if (!param_id_valid((u16)id)) continue;
+        const ParamTemplate *t = param_template((u16)id);
+        s_steps[id] = t->def_step;
+    }
+    // Channels start unmuted, as after /-action/initall (the table default is 0)
+    for (int ch = 0; ch < 16; ch++) s_steps[PARAM_ID(PT_CH_MIX_ON, ch, 0)] = 1;
+    snprintf(s_strings[PARAM_ID(PT_SNAP_NAME, 0, 0)], SIM_STRING_MAX, "Init");
+}
+
+static void snap_save(int slot)
+{
+    Snapshot *s = &s_snaps[slot];
+    if (!s->steps) {
+        s->steps = (u16 *)malloc(sizeof(s_steps));
+        s->strings = malloc(sizeof(s_strings));
+        if (!s->steps || !s->strings) {
+            free(s->steps);
+            free(s->strings);
+            s->steps = NULL;
+            s->strings = NULL;
+            return;
+        }
+    }
+    memcpy(s->steps, s_steps, sizeof(s_steps));
+    memcpy(s->strings, s_strings, sizeof(s_strings));
+    snprintf(s->name, sizeof(s->name), "%s", s_strings[PARAM_ID(PT_SNAP_NAME, 0, 0)]);
+    s_snap_index = slot;
+}
+
+static int snap_load(int slot)
+{
+    Snapshot *s = &s_snaps[slot];
+    if (!s->steps) return 0;
+    memcpy(s_steps, s->steps, sizeof(s_steps));
+    memcpy(s_strings, s->strings, sizeof(s_strings));
+    snprintf(s_strings[PARAM_ID(PT_SNAP_NAME, 0, 0)], SIM_STRING_MAX, "%s", s->name);
+    s_snap_index = slot;
+    return 1;
+}
+
+static void go_note_set(u64 now)
+{
+    if (!s_go_sets || now - s_go_last > (u64)SIM_GO_GAP_MS * 1000000ULL) {
+        s_go_first = now;
+        s_go_sets = 0;
+    }
+    s_go_last = now;
+    s_go_sets++;
+}
+
+static void go_check_end(u64 now)
+{
+    if (!s_go_sets || now - s_go_last <= (u64)SIM_GO_GAP_MS * 1000000ULL) return;
+    s_go_count++;
+    printf("[%9.3f] GO %lu: %lu sets in %.1f ms\n", since_start_s(s_go_first),
+           (unsigned long)s_go_count, (unsigned long)s_go_sets, (double)(s_go_last - s_go_first) / 1e6);
+    fflush(stdout);
+    s_go_sets = 0;
+}
+
+static void answer_query(const struct sockaddr_in *from, u16 id)
+{
+    const ParamTemplate *t = param_template(id);
+    u8 packet[PARAM_PACKET_MAX + SIM_STRING_MAX + 8];
+    int len;
+    if (id == PARAM_ID(PT_SNAP_INDEX, 0, 0)) {
+        // The index is the slot last saved or loaded, not a stored value
+        len = param_encode(id, s_snap_index, packet, sizeof(packet));
+    } else if (t->type == 's') {
+        memset(packet, 0, sizeof(packet));
+        len = param_address(id, (char *)packet);
+        len = put_string(packet, len, sizeof(packet), ",s");
+        len = put_string(packet, len, sizeof(packet), s_strings[id]);
+    } else {
+        len = param_encode(id, s_steps[id], packet, sizeof(packet));
+    }
+    if (len > 0) reply(from, packet, len);
+}
+
+static void handle_set(const struct sockaddr_in *from, u16 id, const u8 *packet, int len, int tag_pos,
+                       u64 now)
+{
+    const ParamTemplate *t = param_template(id);
+    int step;
+    s_second.sets++;
+    go_note_set(now);
+
+    if (t->type == 's') {
+        int pos = tag_pos + 4;
+        const char *value = get_string(packet, len, &pos);
+        if (!value) return;
+        snprintf(s_strings[id], SIM_STRING_MAX, "%s", value);
+    } else if (param_decode(packet, len, &id, &step)) {
+        if (id == PARAM_ID(PT_SNAP_SAVE, 0, 0)) {
+            if (step >= 0 && step < SIM_SNAP_SLOTS) snap_save(step);
+        } else if (id == PARAM_ID(PT_SNAP_LOAD, 0, 0)) {
+            if (step >= 0 && step < SIM_SNAP_SLOTS && !snap_load(step)) {
+                printf("[%9.3f] /-snap/load %d: empty slot\n", since_start_s(now), step);
+            }
+        } else {
+            s_steps[id] = (u16)step;
+        }
+    } else {
+        return;
+    }
+    feedback(from, packet, len, now);
+}
+
+static void handle_packet(const struct sockaddr_in *from, const u8 *packet, int len)
+{
+    u64 now = now_ns();
+    s_second.in++;
+    s_total_in++;
+
+    int pos = 0;
+    const char *addr = get_string(packet, len, &pos);
+    if (!addr || addr[0] != '/') return;
+    int tag_pos = pos;
+    const char *tags = (pos < len) ? get_string(packet, len, &pos) : NULL;
+    int has_args = tags && tags[0] == ',' && tags[1] != '\0';
+    if (s_verbose) printf("[%9.3f] %s %s %s\n", since_start_s(now), addr_text(from), addr, tags ? tags : "");
+
+    if (!strcmp(addr, "/xinfo")) {
+        u8 out[128];
+        int n = put_string(out, 0, sizeof(out), "/xinfo");
+        n = put_string(out, n, sizeof(out), ",ssss");
+        n = put_string(out, n, sizeof(out), s_ip);
+        n = put_string(out, n, sizeof(out), s_name);
+        n = put_string(out, n, sizeof(out), "XR18");
+        n = put_string(out, n, sizeof(out), "1.18");
+        s_second.queries++;
+        reply(from, out, n);
+    } else if (!strcmp(addr, "/status")) {
+        u8 out[128];
+        int n = put_string(out, 0, sizeof(out), "/status");
+        n = put_string(out, n, sizeof(out), ",sss");
+        n = put_string(out, n, sizeof(out), "active");
+        n = put_string(out, n, sizeof(out), s_ip);
+        n = put_string(out, n, sizeof(out), s_name);
+        s_second.queries++;
+        reply(from, out, n);
+    } else if (!strcmp(addr, "/xremote")) {
+        Client *c = client_for(from, now);
+        if (c) c->xremote_until = now + (u64)SIM_SUBSCRIBE_MS * 1000000ULL;
+    } else if (!strcmp(addr, "/meters")) {
+        // Only /meters/1 is produced; other banks are accepted and ignored
+        int arg = pos;
+        const char *bank = (has_args && tags[1] == 's') ? get_string(packet, len, &arg) : NULL;
+        Client *c = client_for(from, now);
+        if (c && bank && !strcmp(bank, "/meters/1")) {
+            c->meters_until = now + (u64)SIM_SUBSCRIBE_MS * 1000000ULL;
+            if (!c->meters_next) c->meters_next = now;
+        }
+    } else {
+        u16 id = param_find(addr);
+        if (id == PARAM_ID_INVALID) {
+            if (s_verbose) printf("            unknown address %s\n", addr);
+            return;
+        }
+        if (has_args) {
+            handle_set(from, id, packet, len, tag_pos, now);
+        } else {
+            s_second.queries++;
+            answer_query(from, id);
+        }
+    }
+}
+
+// ============================================================================
+// MAIN LOOP
+// ============================================================================
+
+static void run_timers(u64 now)
+{
+    // Delayed packets that are due, oldest deadline first
+    for (;;) {
+        int due = -1;
+        for (int i = 0; i < s_queued; i++) {
+            if (s_queue[i]->due <= now && (due < 0 || s_queue[i]->due < s_queue[due]->due)) due = i;
+        }
+        if (due < 0) break;
+        Delayed *d = s_queue[due];
+        s_queue[due] = s_queue[--s_queued];
+        if (d->inbound) handle_packet(&d->addr, d->data, d->len);
+        else send_raw(&d->addr, d->data, d->len);
+        free(d);
+    }
+
+    for (int i = 0; i < SIM_CLIENTS; i++) {
+        Client *c = &s_clients[i];
+        if (c->meters_until > now && c->meters_next <= now) {
+            send_meters(c);
+            c->meters_next = now + (u64)SIM_METERS_MS * 1000000ULL;
+        }
+    }
+
+    // Handling delayed packets moved s_go_last past `now`
+    go_check_end(now_ns());
+}
+
+static u64 next_timer(u64 now)
+{
+    u64 next = now + 100000000ULL;
+    for (int i = 0; i < s_queued; i++) {
+        if (s_queue[i]->due < next) next = s_queue[i]->due;
+    }
+    for (int i = 0; i < SIM_CLIENTS; i++) {
+        if (s_clients[i].meters_until > now && s_clients[i].meters_next < next) next = s_clients[i].meters_next;
+    }
+    if (s_go_sets) {
+        u64 go_end = s_go_last + (u64)SIM_GO_GAP_MS * 1000000ULL + 1;
+        if (go_end < next) next = go_end;
+    }
+    return next;
+}
+
+static void log_second(u64 now)
+{
+    if (s_second.in || s_second.out || s_second.dropped) {
+        int subscribers = 0;
+        for (int i = 0; i < SIM_CLIENTS; i++) {
+            if (s_clients[i].xremote_until > now || s_clients[i].meters_until > now) subscribers++;
+        }
+        printf("[%9.3f] in %lu/s (sets %lu, queries %lu)  out %lu/s  dropped %lu  queued %d  subscribers %d\n",
+               since_start_s(now), (unsigned long)s_second.in, (unsigned long)s_second.sets,
+               (unsigned long)s_second.queries, (unsigned long)s_second.out,
+               (unsigned long)s_second.dropped, s_queued, subscribers);
+        fflush(stdout);
+    }
+    memset(&s_second, 0, sizeof(s_second));
+}
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    s_exit = 1;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [-p PORT] [--name NAME] [--loss PCT] [--reorder PCT] [--latency MS]\n"
+            "          [--jitter MS] [--seed N] [-v]\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+    int port = SIM_DEFAULT_PORT;
+    unsigned seed = (unsigned)time(NULL);
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!strcmp(arg, "-v")) {
+            s_verbose = 1;
+        } else if (!strcmp(arg, "-p") && val) {
+            port = atoi(val);
+            i++;
+        } else if (!strcmp(arg, "--name") && val) {
+            snprintf(s_name, sizeof(s_name), "%s", val);
+            i++;
+        } else if (!strcmp(arg, "--loss") && val) {
+            s_imp.loss = atof(val) / 100.0;
+            i++;
+        } else if (!strcmp(arg, "--reorder") && val) {
+            s_imp.reorder = atof(val) / 100.0;
+            i++;
+        } else if (!strcmp(arg, "--latency") && val) {
+            s_imp.latency_ms = (u32)atoi(val);
+            i++;
+        } else if (!strcmp(arg, "--jitter") && val) {
+            s_imp.jitter_ms = (u32)atoi(val);
+            i++;
+        } else if (!strcmp(arg, "--seed") && val) {
+            seed = (unsigned)strtoul(val, NULL, 0);
+            i++;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    srand(seed);
+
+    fader_taper_init();
+    xair_codec_init();
+    tree_init();
+
+    s_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s_fd < 0) {
+        perror("socket");
+        return 1;
+    }
+    int on = 1;
+    setsockopt(s_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons((u16)port);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(s_fd, (struct sockaddr *)&local, sizeof(local)) < 0) {
+        perror("bind");
+        return 1;
+    }
+
+    u32 own, mask;
+    if (platform_local_subnet(&own, &mask)) {
+        struct in_addr a = { htonl(own) };
+        snprintf(s_ip, sizeof(s_ip), "%s", inet_ntoa(a));
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    s_start_ns = now_ns();
+    printf("X18 stand-in \"%s\" on %s:%d  loss %.1f%%  reorder %.1f%%  latency %lu+%lu ms  seed %u\n",
+           s_name, s_ip, port, s_imp.loss * 100.0, s_imp.reorder * 100.0,
+           (unsigned long)s_imp.latency_ms, (unsigned long)s_imp.jitter_ms, seed);
+    fflush(stdout);
+
+    u64 next_log = s_start_ns + 1000000000ULL;
+    while (!s_exit) {
+        u64 now = now_ns();
+        u64 next = next_timer(now);
+        if (next > next_log) next = next_log;
+        int timeout_ms = (next > now) ? (int)((next - now + 999999ULL) / 1000000ULL) : 0;
+
+        struct pollfd pfd = { s_fd, POLLIN, 0 };
+        if (poll(&pfd, 1, timeout_ms) > 0 && (pfd.revents & POLLIN)) {
+            u8 packet[SIM_PACKET_MAX];
+            struct sockaddr_in from;
+            socklen_t from_len = sizeof(from);
+            int len = (int)recvfrom(s_fd, packet, sizeof(packet), 0, (struct sockaddr *)&from, &from_len);
+            if (len > 0 && impair(1, &from, packet, len)) handle_packet(&from, packet, len);
+        }
+
+        now = now_ns();
+        run_timers(now);
+        if (now >= next_log) {
+            log_second(now);
+            next_log += 1000000000ULL;
+            if (next_log < now) next_log = now + 1000000000ULL;
+        }
+    }
+
+    printf("Stopped: %llu in, %llu out, %llu dropped, %lu GOs\n", (unsigned long long)s_total_in,
+           (unsigned long long)s_total_out, (unsigned long long)s_total_dropped, (unsigned long)s_go_count);
+    close(s_fd);
+    return 0;
+}
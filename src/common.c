@@ -25,15 +25,8 @@ int g_init_complete = 0;
 int g_current_step = 0;
 int g_selected_step = 0;
 int g_selected_fader = 0;
-struct sockaddr_in g_mixer_addr = {0};
-char g_mixer_host[16] = "10.10.99.112";
-int g_mixer_port = 10023;
-int g_osc_connected = 0;
-int g_osc_socket = -1;
-int g_osc_verbose = 1;
 Fader g_faders[NUM_FADERS] = {{0}};
 int g_touched_fader_index = -1;
-Show g_current_show = {{0}};
 int g_show_loaded = 0;
 int g_show_modified = 0;
 
@@ -119,14 +112,18 @@ void draw_debug_text(C2D_Screen *screen, const char *text, float x, float y, flo
     }
     
     C2D_TextOptimize(&c2d_text);
+    g_prof_c2d_objects += c2d_text.end - c2d_text.begin;  // One object per glyph
     C2D_DrawText(&c2d_text, C2D_WithColor, x, y, 0.5f, size, size, color);
 }
 
 void create_shows_directory(void)
 {
+#ifdef __3DS__
     mkdir("/3ds", 0755);
-    mkdir("/3ds/x18mixer", 0755);
-    mkdir("/3ds/x18mixer/gfx", 0755);  // Also create gfx folder for sprite sheets
+#endif
+    mkdir(PLATFORM_DATA_DIR, 0755);
+    mkdir(SHOWS_DIR, 0755);
+    mkdir(PLATFORM_DATA_DIR "/gfx", 0755);  // Also create gfx folder for sprite sheets
 }
 
 // Copy a file from source to destination
@@ -160,20 +157,20 @@ void ensure_sprite_sheets_on_sd(void)
     // Try to copy sprite sheets from RomFS to SD card
     // This ensures CIA has the graphics regardless of RomFS embedding
     
-    FILE *test = fopen("/3ds/x18mixer/gfx/Grip.t3x", "rb");
+    FILE *test = fopen(PLATFORM_DATA_DIR "/gfx/Grip.t3x", "rb");
     if (!test) {
         // Sprite sheet doesn't exist on SD, try to copy from RomFS
-        copy_file("romfs:/gfx/Grip.t3x", "/3ds/x18mixer/gfx/Grip.t3x");
-        copy_file("romfs:/Grip.t3x", "/3ds/x18mixer/gfx/Grip.t3x");
+        copy_file("romfs:/gfx/Grip.t3x", PLATFORM_DATA_DIR "/gfx/Grip.t3x");
+        copy_file("romfs:/Grip.t3x", PLATFORM_DATA_DIR "/gfx/Grip.t3x");
     } else {
         fclose(test);
     }
     
-    test = fopen("/3ds/x18mixer/gfx/FaderBkg.t3x", "rb");
+    test = fopen(PLATFORM_DATA_DIR "/gfx/FaderBkg.t3x", "rb");
     if (!test) {
         // Sprite sheet doesn't exist on SD, try to copy from RomFS
-        copy_file("romfs:/gfx/FaderBkg.t3x", "/3ds/x18mixer/gfx/FaderBkg.t3x");
-        copy_file("romfs:/FaderBkg.t3x", "/3ds/x18mixer/gfx/FaderBkg.t3x");
+        copy_file("romfs:/gfx/FaderBkg.t3x", PLATFORM_DATA_DIR "/gfx/FaderBkg.t3x");
+        copy_file("romfs:/FaderBkg.t3x", PLATFORM_DATA_DIR "/gfx/FaderBkg.t3x");
     } else {
         fclose(test);
     }
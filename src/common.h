@@ -8,6 +8,14 @@
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include "types.h"
+#include "profiler.h"
+#include "trace.h"
+#include "log.h"
+#include "fader_taper.h"
+#include "xair_codec.h"
+#include "param.h"
+#include "show.h"
+#include "osc.h"
 #include "ui_themes.h"
 
 // ============================================================================
@@ -58,15 +66,8 @@ extern int g_init_complete;
 extern int g_current_step;
 extern int g_selected_step;
 extern int g_selected_fader;
-extern struct sockaddr_in g_mixer_addr;
-extern char g_mixer_host[16];
-extern int g_mixer_port;
-extern int g_osc_connected;
-extern int g_osc_socket;
-extern int g_osc_verbose;
 extern Fader g_faders[NUM_FADERS];
 extern int g_touched_fader_index;
-extern Show g_current_show;
 extern int g_show_loaded;
 extern int g_show_modified;
 
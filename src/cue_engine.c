@@ -0,0 +1,491 @@
+#include "cue_engine.h"
+#include "fader_taper.h"
+#include "xair_codec.h"
+#include "osc.h"
+#include "log.h"
+#include "trace.h"
+#include "show.h"
+#include "options.h"
+#include "snap_offload.h"
+#include "go_verify.h"
+#include "link_health.h"
+
+#include <string.h>
+
+// ============================================================================
+// FADE STATE
+// ============================================================================
+
+typedef struct {
+    s32 start_q8;           // dB, Q8.8 (-inf starts from FADER_DB_MIN)
+    s32 end_q8;
+    u64 start_tick;
+    u64 duration_ticks;
+    u16 target_step;
+    u16 last_step;          // Last step sent for this fade
+} ChannelFade;
+
+static ChannelFade s_fades[16];
+static u16 s_active = 0;            // Bit per channel; guarded by s_lock
+static LightLock s_lock;
+
+static Thread s_thread = NULL;
+static LightEvent s_wake;
+static volatile int s_exit = 0;
+
+static LightLock s_show_lock;
+
+void cue_lock_show(void)
+{
+    LightLock_Lock(&s_show_lock);
+}
+
+void cue_unlock_show(void)
+{
+    LightLock_Unlock(&s_show_lock);
+}
+
+static s32 step_to_fade_db_q8(int step)
+{
+    return (step <= 0) ? (s32)(FADER_DB_MIN * 256.0f) : fader_step_to_db_q8(step);
+}
+
+#define CUE_NO_FADE_OVERRIDE 0xFFFFFFFFu
+static u32 s_fade_override_ms = CUE_NO_FADE_OVERRIDE;  // Set by cue_fire() under the show lock
+
+u32 cue_fade_ms(const Step *step, int channel)
+{
+    if (s_fade_override_ms != CUE_NO_FADE_OVERRIDE) return s_fade_override_ms;
+    
+    u16 tenths = step->fade_tenths;
+    if (channel >= 0 && channel < 16 && step->channel_fade_tenths[channel]) {
+        tenths = step->channel_fade_tenths[channel];
+    }
+    return tenths * 100u;
+}
+
+int cue_fade_channel(int channel, int target_step, u32 duration_ms)
+{
+    if (channel < 0 || channel >= 16) return 0;
+
+    LightLock_Lock(&s_lock);
+    int from = xair_shadow_fader_get(channel);
+    int fade = s_thread && duration_ms > 0 && from != XAIR_STEP_UNKNOWN && from != target_step;
+    if (fade) {
+        ChannelFade *f = &s_fades[channel];
+        f->start_q8 = step_to_fade_db_q8(from);
+        f->end_q8 = step_to_fade_db_q8(target_step);
+        f->start_tick = svcGetSystemTick();
+        f->duration_ticks = (u64)(duration_ms * CPU_TICKS_PER_MSEC);
+        f->target_step = (u16)target_step;
+        f->last_step = (u16)from;
+        s_active |= (1 << channel);
+    } else {
+        s_active &= ~(1 << channel);
+    }
+    LightLock_Unlock(&s_lock);
+
+    if (fade) LightEvent_Signal(&s_wake);
+    return fade;
+}
+
+void cue_fade_cancel_all(void)
+{
+    LightLock_Lock(&s_lock);
+    s_active = 0;
+    LightLock_Unlock(&s_lock);
+}
+
+u16 cue_fades_active(void)
+{
+    return __atomic_load_n(&s_active, __ATOMIC_RELAXED);
+}
+
+// ============================================================================
+// TIMER THREAD
+// ============================================================================
+
+// Advance every active fade to `now`; returns the number of channels sent
+static int cue_fade_tick(u64 now)
+{
+    int n = 0;
+
+    // Sends happen under the lock: a GO that takes a channel over waits for
+    // them, so a stale fade value can never land after the new one
+    LightLock_Lock(&s_lock);
+    for (int ch = 0; ch < 16; ch++) {
+        if (!(s_active & (1 << ch))) continue;
+        ChannelFade *f = &s_fades[ch];
+
+        int step;
+        u64 elapsed = now - f->start_tick;
+        if (elapsed >= f->duration_ticks) {
+            step = f->target_step;
+            s_active &= ~(1 << ch);
+        } else {
+            s32 db_q8 = f->start_q8 +
+                        (s32)((s64)(f->end_q8 - f->start_q8) * (s64)elapsed / (s64)f->duration_ticks);
+            step = fader_db_to_step(db_q8 / 256.0f);
+        }
+
+        // Coalesce: nothing to send until the console step moves
+        if (step != f->last_step) {
+            f->last_step = (u16)step;
+            osc_send_fader_step(ch, step);
+            n++;
+        }
+    }
+    LightLock_Unlock(&s_lock);
+    return n;
+}
+
+// ============================================================================
+// STEP RECALL
+// ============================================================================
+
+// Send a step's data via OSC: faders, mutes, EQ and stored params, limited
+// to the channels and groups in the step's recall scope minus the show's
+// channel safes
+void send_step_osc(int step_idx)
+{
+    if (step_idx < 0 || step_idx >= g_current_show.num_steps) {
+        LOG_WARN("[SEND_STEP] Invalid step index %d", step_idx);
+        return;
+    }
+    if (!g_osc_connected) {
+        LOG_WARN("[SEND_STEP] OSC not connected, step %d not sent", step_idx + 1);
+        return;
+    }
+    
+    // An up-to-date console snapshot recalls the whole step in one message
+    if (snap_offload_recall(step_idx)) return;
+    
+    TRACE_BEGIN("send_step");
+    Step *step = &g_current_show.steps[step_idx];
+    u16 channels = (u16)~(step->released_channels | g_current_show.channel_safes);
+    u8 groups = (u8)(~step->released_groups & STEP_SCOPE_ALL);
+    int sent = 0;
+    
+    // Faders (if enabled): faded channels are handed to the cue engine
+    int faded = 0;
+    if (g_options.send_fader && (groups & STEP_SCOPE_FADER)) {
+        for (int ch = 0; ch < 16; ch++) {
+            if (!(channels & (1 << ch))) continue;
+            int target = fader_value_to_step(step->volumes[ch]);
+            if (cue_fade_channel(ch, target, cue_fade_ms(step, ch))) {
+                faded++;
+                continue;
+            }
+            osc_send_fader_step(ch, target);
+            sent++;
+        }
+    }
+    
+    // Mutes (not subject to the send options)
+    if (groups & STEP_SCOPE_MUTE) {
+        for (int ch = 0; ch < 16; ch++) {
+            if (!(channels & (1 << ch))) continue;
+            osc_send_mute(ch, step->mutes[ch]);
+            sent++;
+        }
+    }
+    
+    // EQ data (5 bands per channel) - if enabled AND channel EQ is enabled
+    if (g_options.send_eq && (groups & STEP_SCOPE_EQ)) {
+        for (int ch = 0; ch < 16; ch++) {
+            ChannelEQ *eq = &step->eqs[ch];
+            // Only send EQ data if this channel's EQ is enabled
+            if (!eq->enabled || !(channels & (1 << ch))) continue;
+            for (int band = 0; band < 5; band++) {
+                EQBand *eq_band = &eq->bands[band];
+                // Send EQ band type, frequency, gain, Q factor
+                osc_send_eq_param(ch, band, XAIR_EQ_TYPE, (float)eq_band->type);
+                osc_send_eq_param(ch, band, XAIR_EQ_FREQ, eq_band->frequency);
+                osc_send_eq_param(ch, band, XAIR_EQ_GAIN, eq_band->gain);
+                osc_send_eq_param(ch, band, XAIR_EQ_Q, eq_band->q_factor);
+                sent += 4;
+            }
+        }
+    }
+    
+    // Everything else the step stores, in id order
+    if (groups & STEP_SCOPE_PARAMS) {
+        const ParamList *params = &step->params;
+        for (int i = 0; i < params->count; i++) {
+            int ch = param_channel(params->items[i].id);
+            if (ch >= 0 && !(channels & (1 << ch))) continue;
+            osc_send_param(params->items[i].id, params->items[i].step);
+            sent++;
+        }
+    }
+    
+    LOG_INFO("[SEND_STEP] Step %d sent (%d msgs, %d fading, channels=%04X, groups=%X)", step_idx + 1,
+             sent, faded, channels, groups);
+    TRACE_END("send_step");
+}
+
+// ============================================================================
+// FIRING AND AUTO-FOLLOW
+// ============================================================================
+
+// Guarded by s_lock
+static int s_follow_step = -1;          // Step waiting to fire, -1 = none
+static u64 s_follow_deadline = 0;
+static u64 s_show_start = 0;            // When step 1 last fired (0 = not yet)
+static CueJitterStats s_jitter;
+
+static volatile u32 s_fired_seq = 0;
+static volatile int s_fired_step = -1;
+static volatile u32 s_fired_seen = 0;   // Written by the main thread only
+static int s_standby = 0;               // Step the next GO fires; guarded by s_lock
+
+static u64 ms_to_ticks(u32 ms)
+{
+    return (u64)ms * (u64)SYSCLOCK_ARM11 / 1000u;
+}
+
+// Arm the step after fired_idx if it follows; caller holds the show lock
+static void cue_schedule_follow(int fired_idx, u64 fired_tick)
+{
+    int next = fired_idx + 1;
+    int step = -1;
+    u64 deadline = 0;
+
+    if (next < g_current_show.num_steps) {
+        const Step *st = &g_current_show.steps[next];
+        if (st->follow_mode == STEP_FOLLOW_AFTER) {
+            step = next;
+            deadline = fired_tick + ms_to_ticks(st->follow_ms);
+        } else if (st->follow_mode == STEP_FOLLOW_AT && s_show_start) {
+            step = next;
+            deadline = s_show_start + ms_to_ticks(st->follow_ms);
+        }
+    }
+
+    LightLock_Lock(&s_lock);
+    s_follow_step = step;
+    s_follow_deadline = deadline;
+    LightLock_Unlock(&s_lock);
+}
+
+// Caller holds the show lock
+static void send_step_with_fade(int step_idx, u32 fade_ms)
+{
+    s_fade_override_ms = fade_ms;
+    send_step_osc(step_idx);
+    s_fade_override_ms = CUE_NO_FADE_OVERRIDE;
+}
+
+// planned = 0 for a manual GO; fade_ms overrides the step's fade times
+// unless it is CUE_NO_FADE_OVERRIDE. 0 if the show has no such step.
+static int cue_fire(int step_idx, u64 planned, u32 fade_ms)
+{
+    cue_lock_show();
+    if (step_idx < 0 || step_idx >= g_current_show.num_steps) {
+        cue_unlock_show();
+        return 0;
+    }
+
+    u64 now = svcGetSystemTick();
+    if (step_idx == 0) s_show_start = now;
+
+    if (planned) {
+        s32 jitter_us = (s32)((s64)(now - planned) / (s64)(SYSCLOCK_ARM11 / 1000000));
+        LightLock_Lock(&s_lock);
+        s_jitter.count++;
+        s_jitter.last_us = jitter_us;
+        s_jitter.sum_us += jitter_us;
+        if (jitter_us > s_jitter.max_us) s_jitter.max_us = jitter_us;
+        LightLock_Unlock(&s_lock);
+        LOG_DEBUG("cue: step %d followed, jitter %ld us", step_idx + 1, (long)jitter_us);
+    }
+
+    // Remote and follow GOs cannot be held back for a confirmation; at least say so
+    if (link_health_state() == LINK_DEAD) {
+        LOG_WARN("[LINK] GO step %d into a dead link", step_idx + 1);
+    }
+
+    TRACE_INSTANT("GO");
+    send_step_with_fade(step_idx, fade_ms);
+    go_verify_request(step_idx);
+    cue_schedule_follow(step_idx, now);
+
+    LightLock_Lock(&s_lock);
+    s_fired_step = step_idx;
+    s_standby = (step_idx + 1) % g_current_show.num_steps;
+    __atomic_add_fetch(&s_fired_seq, 1, __ATOMIC_RELEASE);
+    LightLock_Unlock(&s_lock);
+    cue_unlock_show();
+    return 1;
+}
+
+int cue_go(int step_idx)
+{
+    return cue_go_fade(step_idx, CUE_NO_FADE_OVERRIDE);
+}
+
+int cue_go_fade(int step_idx, u32 fade_ms)
+{
+    int fired = cue_fire(step_idx, 0, fade_ms);
+    // Re-evaluate the thread's sleep: a follow may have been armed
+    if (fired && s_thread) LightEvent_Signal(&s_wake);
+    return fired;
+}
+
+void cue_send_step(int step_idx, u32 fade_ms)
+{
+    cue_lock_show();
+    if (step_idx >= 0 && step_idx < g_current_show.num_steps) {
+        send_step_with_fade(step_idx, fade_ms);
+    }
+    cue_unlock_show();
+}
+
+int cue_standby(void)
+{
+    LightLock_Lock(&s_lock);
+    int step = s_standby;
+    LightLock_Unlock(&s_lock);
+    return step;
+}
+
+int cue_last_fired(void)
+{
+    return s_fired_step;
+}
+
+void cue_set_standby(int step_idx)
+{
+    // A step fired that the main loop has not picked up yet: it moves the
+    // standby itself, so a stale selection must not override it
+    LightLock_Lock(&s_lock);
+    if (s_fired_seen == s_fired_seq) s_standby = step_idx;
+    LightLock_Unlock(&s_lock);
+}
+
+int cue_take_fired(int *out_step_idx)
+{
+    u32 seq = __atomic_load_n(&s_fired_seq, __ATOMIC_ACQUIRE);
+    if (seq == s_fired_seen) return 0;
+    s_fired_seen = seq;
+    *out_step_idx = s_fired_step;
+    return 1;
+}
+
+void cue_follow_cancel(void)
+{
+    LightLock_Lock(&s_lock);
+    s_follow_step = -1;
+    LightLock_Unlock(&s_lock);
+}
+
+int cue_follow_pending(u32 *out_remaining_ms)
+{
+    LightLock_Lock(&s_lock);
+    int step = s_follow_step;
+    u64 deadline = s_follow_deadline;
+    LightLock_Unlock(&s_lock);
+
+    if (step >= 0 && out_remaining_ms) {
+        u64 now = svcGetSystemTick();
+        *out_remaining_ms = (deadline > now) ? (u32)((deadline - now) * 1000u / SYSCLOCK_ARM11) : 0;
+    }
+    return step;
+}
+
+void cue_jitter_stats(CueJitterStats *out)
+{
+    LightLock_Lock(&s_lock);
+    *out = s_jitter;
+    LightLock_Unlock(&s_lock);
+}
+
+// ============================================================================
+// TIMER THREAD
+// ============================================================================
+
+static void cue_thread_main(void *arg)
+{
+    (void)arg;
+    const u64 tick_ticks = ms_to_ticks(CUE_TICK_MS);
+    u64 fade_deadline = 0;
+    int fading = 0;
+
+    while (!s_exit) {
+        u64 now = svcGetSystemTick();
+
+        // Auto-follow
+        LightLock_Lock(&s_lock);
+        int follow = s_follow_step;
+        u64 planned = s_follow_deadline;
+        if (follow >= 0 && now >= planned) s_follow_step = -1;
+        LightLock_Unlock(&s_lock);
+
+        if (follow >= 0 && now >= planned) {
+            cue_fire(follow, planned, CUE_NO_FADE_OVERRIDE);
+            continue;   // The step may have started fades or armed a follower
+        }
+
+        // Crossfades: absolute deadlines, so the tick period does not drift
+        // with the time spent sending. If we fell behind, tick again at once
+        // (the interpolation is time-based, so nothing is lost).
+        if (cue_fades_active()) {
+            if (!fading) {
+                fading = 1;
+                fade_deadline = now;
+            }
+            if (now >= fade_deadline) {
+                TRACE_BEGIN("fade_tick");
+                cue_fade_tick(now);
+                TRACE_END("fade_tick");
+                fade_deadline += tick_ticks;
+                if (fade_deadline < now) fade_deadline = now;
+            }
+        } else {
+            fading = 0;
+        }
+
+        // Sleep until the earliest deadline, or until a GO wakes us
+        u64 wake = U64_MAX;
+        if (fading && cue_fades_active()) wake = fade_deadline;
+        LightLock_Lock(&s_lock);
+        if (s_follow_step >= 0 && s_follow_deadline < wake) wake = s_follow_deadline;
+        LightLock_Unlock(&s_lock);
+
+        now = svcGetSystemTick();
+        if (wake == U64_MAX) {
+            LightEvent_Wait(&s_wake);
+        } else if (wake > now) {
+            LightEvent_WaitTimeout(&s_wake, (s64)((wake - now) * 1000.0 / CPU_TICKS_PER_USEC));
+        }
+    }
+}
+
+void cue_engine_init(void)
+{
+    memset(s_fades, 0, sizeof(s_fades));
+    s_active = 0;
+    LightLock_Init(&s_lock);
+    LightLock_Init(&s_show_lock);
+    LightEvent_Init(&s_wake, RESET_ONESHOT);
+    s_exit = 0;
+
+    // Above the main thread: a slow frame must not delay a fade tick or a follow
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    s_thread = threadCreate(cue_thread_main, NULL, 8 * 1024, prio - 1, -2, false);
+    if (!s_thread) {
+        LOG_WARN("cue: timer thread not started, fades will jump and follows will not fire");
+    }
+}
+
+void cue_engine_shutdown(void)
+{
+    if (!s_thread) return;
+
+    s_exit = 1;
+    LightEvent_Signal(&s_wake);
+    threadJoin(s_thread, U64_MAX);
+    threadFree(s_thread);
+    s_thread = NULL;
+}
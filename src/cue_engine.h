@@ -0,0 +1,71 @@
+#ifndef CUE_ENGINE_H
+#define CUE_ENGINE_H
+
+#include "platform.h"
+#include "types.h"
+
+// ============================================================================
+// CUE ENGINE
+// ============================================================================
+// Step transitions that take time run on the engine's own thread, one
+// priority above the main loop and independent of the 60 Hz frame. It
+// sleeps until the earliest of two deadlines (monotonic system ticks):
+//
+// Crossfades: a GO hands each faded channel to the engine, which advances it
+// every CUE_TICK_MS. Positions are interpolated in dB along the X18 taper
+// (fader_taper.h) from the last value sent to the target, as a function of
+// elapsed ticks, so a late tick never stretches a fade. Every tick sends
+// only the channels whose console step changed. Fade times are in tenths of
+// a second: Step.fade_tenths, or Step.channel_fade_tenths[ch] (0 = step time).
+//
+// Auto-follow: when a step fires, the next one is scheduled if its
+// follow_mode says so (STEP_FOLLOW_AFTER: follow_ms after this step,
+// STEP_FOLLOW_AT: follow_ms after step 1 fired). Every timed firing records
+// its actual-vs-planned jitter.
+//
+// Steps fire through cue_go() from any thread. The main loop picks up the
+// new position with cue_take_fired().
+
+#define CUE_TICK_MS         10
+
+void cue_engine_init(void);
+void cue_engine_shutdown(void);
+
+// Held while a step is sent; take it around anything that reallocates or
+// replaces g_current_show (loading, param list edits)
+void cue_lock_show(void);
+void cue_unlock_show(void);
+
+// ---- Crossfades ----
+u32 cue_fade_ms(const Step *step, int channel);
+
+// Start fading channel to target_step over duration_ms. Returns 0 (and
+// cancels any fade on the channel) when the caller should send the value
+// itself: no duration, or the current console position is unknown.
+int cue_fade_channel(int channel, int target_step, u32 duration_ms);
+void cue_fade_cancel_all(void);
+u16 cue_fades_active(void);     // Bit per channel still moving
+
+// ---- Firing and auto-follow ----
+void send_step_osc(int step_idx);           // Recall the step in its scope; caller holds the show lock
+// Send the step now and schedule its follower; 0 if the show has no such step
+int cue_go(int step_idx);
+int cue_go_fade(int step_idx, u32 fade_ms);     // Same, every fader fading over fade_ms
+void cue_send_step(int step_idx, u32 fade_ms);  // Send only: no follow, not reported as fired
+int cue_take_fired(int *out_step_idx);      // 1 if a step fired since the last call
+int cue_last_fired(void);                   // -1 before the first GO
+int cue_standby(void);                      // Step the next GO fires (after the last fired one)
+void cue_set_standby(int step_idx);         // Main thread: the operator selected a step
+void cue_follow_cancel(void);
+int cue_follow_pending(u32 *out_remaining_ms);  // Step index due to fire, or -1
+
+typedef struct {
+    u32 count;              // Timed firings
+    s32 last_us;            // Actual - planned
+    s32 max_us;
+    s64 sum_us;
+} CueJitterStats;
+
+void cue_jitter_stats(CueJitterStats *out);
+
+#endif
@@ -0,0 +1,197 @@
+#include "eq_engine.h"
+
+#include <math.h>
+#include <string.h>
+
+// ============================================================================
+// FREQUENCY GRID
+// ============================================================================
+
+static float s_grid_freq[EQ_GRID_POINTS];
+static float s_grid_phi[EQ_GRID_POINTS];    // sin^2(w/2)
+static int s_grid_ready = 0;
+
+void eq_engine_init(void)
+{
+    if (s_grid_ready) return;
+
+    for (int i = 0; i < EQ_GRID_POINTS; i++) {
+        float pos = (float)i / EQ_GRID_POINTS;
+        float freq = EQ_GRID_F_MIN * powf(EQ_GRID_F_MAX / EQ_GRID_F_MIN, pos);
+        float sh = sinf((float)M_PI * freq / EQ_SAMPLE_RATE);
+        s_grid_freq[i] = freq;
+        s_grid_phi[i] = sh * sh;
+    }
+    s_grid_ready = 1;
+}
+
+float eq_grid_freq(int i)
+{
+    if (!s_grid_ready) eq_engine_init();
+    if (i < 0) i = 0;
+    if (i >= EQ_GRID_POINTS) i = EQ_GRID_POINTS - 1;
+    return s_grid_freq[i];
+}
+
+// ============================================================================
+// COEFFICIENTS (RBJ Audio EQ Cookbook)
+// ============================================================================
+
+void eq_biquad_design(const EQBand *band, EQBiquad *out)
+{
+    // Double precision: at low frequencies the poles sit right next to z=1
+    // and float rounding swamps the response (runs only on a change)
+    double f0 = band->frequency;
+    double q = band->q_factor;
+    double gain = band->gain;
+
+    if (f0 < 10.0) f0 = 10.0;
+    if (f0 > EQ_SAMPLE_RATE * 0.49) f0 = EQ_SAMPLE_RATE * 0.49;
+    if (q < 0.1) q = 0.1;
+
+    double w0 = 2.0 * M_PI * f0 / EQ_SAMPLE_RATE;
+    double cw = cos(w0);
+    double sw = sin(w0);
+    double A = pow(10.0, gain / 40.0);
+    double b0, b1, b2, a0, a1, a2;
+
+    switch (band->type) {
+        case EQ_LCUT:
+        case EQ_HCUT:
+        {
+            // 12 dB/oct Butterworth; the console ignores gain and Q here
+            double alpha = sw / (2.0 * M_SQRT1_2);
+            double k = (band->type == EQ_LCUT) ? (1.0 + cw) : (1.0 - cw);
+            b0 = k * 0.5;
+            b1 = (band->type == EQ_LCUT) ? -k : k;
+            b2 = k * 0.5;
+            a0 = 1.0 + alpha;
+            a1 = -2.0 * cw;
+            a2 = 1.0 - alpha;
+            break;
+        }
+        case EQ_LSHV:
+        case EQ_HSHV:
+        {
+            double alpha = sw / (2.0 * q);
+            double sa = 2.0 * sqrt(A) * alpha;
+            double s = (band->type == EQ_LSHV) ? 1.0 : -1.0;   // Mirrors the cos terms
+            b0 = A * ((A + 1.0) - s * (A - 1.0) * cw + sa);
+            b1 = s * 2.0 * A * ((A - 1.0) - s * (A + 1.0) * cw);
+            b2 = A * ((A + 1.0) - s * (A - 1.0) * cw - sa);
+            a0 = (A + 1.0) + s * (A - 1.0) * cw + sa;
+            a1 = -s * 2.0 * ((A - 1.0) + s * (A + 1.0) * cw);
+            a2 = (A + 1.0) + s * (A - 1.0) * cw - sa;
+            break;
+        }
+        case EQ_VPEQ:
+            // Vintage: bandwidth narrows as the boost/cut grows
+            q *= pow(10.0, fabs(gain) / 40.0);
+            // fall through
+        case EQ_PEQ:
+        default:
+        {
+            double alpha = sw / (2.0 * q);
+            b0 = 1.0 + alpha * A;
+            b1 = -2.0 * cw;
+            b2 = 1.0 - alpha * A;
+            a0 = 1.0 + alpha / A;
+            a1 = -2.0 * cw;
+            a2 = 1.0 - alpha / A;
+            break;
+        }
+    }
+
+    double inv = 1.0 / a0;
+    out->b0 = b0 * inv;
+    out->b1 = b1 * inv;
+    out->b2 = b2 * inv;
+    out->a1 = a1 * inv;
+    out->a2 = a2 * inv;
+}
+
+// ============================================================================
+// MAGNITUDE
+// ============================================================================
+// RBJ's sin^2 form, well conditioned down to the bottom of the grid:
+//
+//   |H|^2 = (N0 - N1 phi + N2 phi^2) / (D0 - D1 phi + D2 phi^2),  phi = sin^2(w/2)
+//
+// so a whole curve is a few multiply-adds, a divide and a log per point.
+
+typedef struct {
+    float n0, n1, n2;
+    float d0, d1, d2;
+} EQPowerTerms;
+
+static void power_terms(const EQBiquad *bq, EQPowerTerms *t)
+{
+    double b0 = bq->b0, b1 = bq->b1, b2 = bq->b2;
+    double a1 = bq->a1, a2 = bq->a2;
+    double bs = b0 + b1 + b2;
+    double as = 1.0 + a1 + a2;
+
+    t->n0 = (float)(bs * bs);
+    t->n1 = (float)(4.0 * (b0 * b1 + 4.0 * b0 * b2 + b1 * b2));
+    t->n2 = (float)(16.0 * b0 * b2);
+    t->d0 = (float)(as * as);
+    t->d1 = (float)(4.0 * (a1 + 4.0 * a2 + a1 * a2));
+    t->d2 = (float)(16.0 * a2);
+}
+
+#define EQ_POWER_FLOOR 1e-12f   // Keeps log10f finite in the stop band
+
+static inline float power_db(const EQPowerTerms *t, float phi)
+{
+    float num = t->n0 - phi * (t->n1 - phi * t->n2);
+    float den = t->d0 - phi * (t->d1 - phi * t->d2);
+    if (num < EQ_POWER_FLOOR) num = EQ_POWER_FLOOR;
+    if (den < EQ_POWER_FLOOR) den = EQ_POWER_FLOOR;
+    return 10.0f * log10f(num / den);
+}
+
+float eq_biquad_db(const EQBiquad *bq, float freq_hz)
+{
+    EQPowerTerms t;
+    power_terms(bq, &t);
+
+    float sh = sinf((float)M_PI * freq_hz / EQ_SAMPLE_RATE);
+    return power_db(&t, sh * sh);
+}
+
+static void band_curve(const EQBand *band, float *out_db)
+{
+    EQBiquad bq;
+    EQPowerTerms t;
+    eq_biquad_design(band, &bq);
+    power_terms(&bq, &t);
+
+    for (int i = 0; i < EQ_GRID_POINTS; i++) {
+        out_db[i] = power_db(&t, s_grid_phi[i]);
+    }
+}
+
+int eq_curve_update(EQCurveCache *cache, const ChannelEQ *eq)
+{
+    if (!s_grid_ready) eq_engine_init();
+
+    int changed = 0;
+    for (int b = 0; b < EQ_NUM_BANDS; b++) {
+        if (cache->valid && memcmp(&cache->bands[b], &eq->bands[b], sizeof(EQBand)) == 0) {
+            continue;
+        }
+        memcpy(&cache->bands[b], &eq->bands[b], sizeof(EQBand));
+        band_curve(&eq->bands[b], cache->band_db[b]);
+        changed++;
+    }
+
+    if (changed) {
+        for (int i = 0; i < EQ_GRID_POINTS; i++) {
+            float sum = 0.0f;
+            for (int b = 0; b < EQ_NUM_BANDS; b++) sum += cache->band_db[b][i];
+            cache->total_db[i] = sum;
+        }
+        cache->valid = 1;
+    }
+    return changed;
+}
@@ -0,0 +1,43 @@
+#ifndef EQ_ENGINE_H
+#define EQ_ENGINE_H
+
+#include "types.h"
+
+// ============================================================================
+// EQ MAGNITUDE ENGINE
+// ============================================================================
+// Each EQBand is turned into an RBJ-cookbook biquad at the console's sample
+// rate, and |H(e^jw)| is evaluated on a fixed log-frequency grid (one point
+// per pixel of the EQ graph). Coefficients and curves are only recomputed
+// when a band's parameters change; drawing a frame just reads the arrays.
+
+#define EQ_SAMPLE_RATE      48000.0f
+#define EQ_GRID_POINTS      320         // Width of the EQ graph in pixels
+#define EQ_GRID_F_MIN       20.0f
+#define EQ_GRID_F_MAX       20000.0f
+#define EQ_NUM_BANDS        5
+
+// Normalized biquad (a0 == 1)
+typedef struct {
+    double b0, b1, b2;
+    double a1, a2;
+} EQBiquad;
+
+// Response of one channel EQ on the grid, in dB
+typedef struct {
+    EQBand bands[EQ_NUM_BANDS];         // Parameters the curves were built from
+    int valid;
+    float band_db[EQ_NUM_BANDS][EQ_GRID_POINTS];
+    float total_db[EQ_GRID_POINTS];
+} EQCurveCache;
+
+void eq_engine_init(void);
+void eq_biquad_design(const EQBand *band, EQBiquad *out);
+float eq_biquad_db(const EQBiquad *bq, float freq_hz);
+float eq_grid_freq(int i);
+
+// Recompute only the bands that changed since the last call.
+// Returns the number of bands recomputed (0 = cache was already current).
+int eq_curve_update(EQCurveCache *cache, const ChannelEQ *eq);
+
+#endif
@@ -15,86 +15,8 @@ const char* get_filter_type_name(EQFilterType type)
     }
 }
 
-// Calculate EQ response at a specific frequency for a single band
-float calculate_eq_response(EQBand *band, float freq_hz)
-{
-    if (band->frequency <= 0 || band->q_factor <= 0) return 0.0f;
-    
-    float delta = freq_hz / band->frequency;
-    if (delta < 0.01f) delta = 0.01f;
-    if (delta > 100.0f) delta = 100.0f;
-    
-    float octave_dist = logf(delta) / logf(2.0f);
-    float response = 0.0f;
-    
-    switch(band->type) {
-        case EQ_PEQ:  // Peak EQ - symmetric peak at center frequency
-        {
-            // Narrower gaussian based on Q factor
-            float q_width = 1.0f / band->q_factor;
-            response = band->gain * expf(-((octave_dist * octave_dist) / (2.0f * q_width * q_width)));
-            break;
-        }
-        case EQ_VPEQ: // Vintage Peaky - sharper, more resonant peak
-        {
-            // Higher Q effect - narrower peak
-            float q_width = 0.5f / band->q_factor;
-            response = band->gain * expf(-((octave_dist * octave_dist) / (2.0f * q_width * q_width)));
-            break;
-        }
-        case EQ_LSHV: // Low Shelf - boost/cut below frequency
-        {
-            // Smooth shelf response using tanh for smooth transition
-            // Below frequency: full gain, above: gradually rolls off
-            float transition_sharpness = band->q_factor * 2.0f;
-            float shelf_curve = tanhf((1.0f - octave_dist) * transition_sharpness) * 0.5f + 0.5f;
-            response = band->gain * shelf_curve;
-            break;
-        }
-        case EQ_HSHV: // High Shelf - boost/cut above frequency
-        {
-            // Smooth shelf response using tanh for smooth transition
-            // Above frequency: full gain, below: gradually rolls off
-            float transition_sharpness = band->q_factor * 2.0f;
-            float shelf_curve = tanhf((octave_dist - 1.0f) * transition_sharpness) * 0.5f + 0.5f;
-            response = band->gain * shelf_curve;
-            break;
-        }
-        case EQ_LCUT: // Low Cut (High Pass) - smooth high-pass filter
-        {
-            // Butterworth-style high pass: smooth rolloff below frequency
-            // HP response = delta^order / (1 + delta^order)
-            // delta < 1: HP ≈ 0 (blocks low freq)
-            // delta > 1: HP ≈ 1 (passes high freq)
-            float order = band->q_factor * 2.0f;  // Q determines steepness
-            float hp_response = powf(delta, order) / (1.0f + powf(delta, order));
-            // Gain controls the amount of cut/boost, follows gain at all points
-            response = band->gain * (1.0f - hp_response);
-            break;
-        }
-        case EQ_HCUT: // High Cut (Low Pass) - smooth low-pass filter
-        {
-            // Butterworth-style low pass: smooth rolloff above frequency
-            // LP response = 1 / (1 + (f/f0)^order)
-            // delta < 1: LP ≈ 1 (passes low freq)
-            // delta > 1: LP ≈ 0 (blocks high freq)
-            float order = band->q_factor * 2.0f;  // Q determines steepness
-            float lp_response = 1.0f / (1.0f + powf(delta, order));
-            // Gain controls the amount of cut/boost, follows gain at all points
-            response = band->gain * (1.0f - lp_response);
-            break;
-        }
-        default:
-            response = 0.0f;
-            break;
-    }
-    
-    // Clamp response to reasonable values for visualization
-    if (response > 15.0f) response = 15.0f;
-    if (response < -15.0f) response = -15.0f;
-    
-    return response;
-}
+// Curves of the EQ being edited, rebuilt only when a band changes
+static EQCurveCache s_eq_curves;
 
 // Draw EQ curve and graph on bottom screen with touch controls
 void render_eq_window(void)
@@ -190,20 +112,20 @@ void render_eq_window(void)
     // Band colors
     u32 band_colors[] = {clrCyan, clrGreen, clrYellow, clrOrange, clrMagenta};
     
+    // graph_w == EQ_GRID_POINTS: one grid point per pixel
+    eq_curve_update(&s_eq_curves, eq);
+    
     // First pass: draw all non-selected bands
     for (int b = 0; b < 5; b++) {
         if (b == g_eq_selected_band) continue;  // Skip selected band, draw it last
         
-        EQBand *band = &eq->bands[b];
+        const float *curve = s_eq_curves.band_db[b];
         
         int prev_x = graph_x;
         int prev_y = center_y;
         
         for (int x = graph_x; x < graph_x + graph_w; x += 1) {
-            float log_pos = (float)(x - graph_x) / (float)graph_w;
-            float freq = 20.0f * powf(20000.0f / 20.0f, log_pos);
-            
-            float response_db = calculate_eq_response(band, freq);
+            float response_db = curve[x - graph_x];
             if (response_db > 15.0f) response_db = 15.0f;
             if (response_db < -15.0f) response_db = -15.0f;
             
@@ -222,16 +144,13 @@ void render_eq_window(void)
     
     // Second pass: draw selected band on top (foreground)
     {
-        EQBand *band = &eq->bands[g_eq_selected_band];
+        const float *curve = s_eq_curves.band_db[g_eq_selected_band];
         
         int prev_x = graph_x;
         int prev_y = center_y;
         
         for (int x = graph_x; x < graph_x + graph_w; x += 1) {
-            float log_pos = (float)(x - graph_x) / (float)graph_w;
-            float freq = 20.0f * powf(20000.0f / 20.0f, log_pos);
-            
-            float response_db = calculate_eq_response(band, freq);
+            float response_db = curve[x - graph_x];
             if (response_db > 15.0f) response_db = 15.0f;
             if (response_db < -15.0f) response_db = -15.0f;
             
@@ -254,13 +173,7 @@ void render_eq_window(void)
         int prev_y = center_y;
         
         for (int x = graph_x; x < graph_x + graph_w; x += 1) {
-            float log_pos = (float)(x - graph_x) / (float)graph_w;
-            float freq = 20.0f * powf(20000.0f / 20.0f, log_pos);
-            
-            float total_gain = 0;
-            for (int b = 0; b < 5; b++) {
-                total_gain += calculate_eq_response(&eq->bands[b], freq);
-            }
+            float total_gain = s_eq_curves.total_db[x - graph_x];
             
             if (total_gain > 15.0f) total_gain = 15.0f;
             if (total_gain < -15.0f) total_gain = -15.0f;
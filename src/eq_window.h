@@ -2,6 +2,7 @@
 #define EQ_WINDOW_H
 
 #include "common.h"
+#include "eq_engine.h"
 
 // ============================================================================
 // EQ WINDOW FUNCTIONS
@@ -17,6 +18,5 @@ void update_eq_touch(void);
 // ============================================================================
 
 const char* get_filter_type_name(EQFilterType type);
-float calculate_eq_response(EQBand *band, float freq_hz);
 
 #endif
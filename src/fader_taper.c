@@ -0,0 +1,99 @@
+#include "fader_taper.h"
+
+#include <math.h>
+#include <stdio.h>
+
+// ============================================================================
+// TABLES
+// ============================================================================
+
+static s16 s_db_q8[FADER_STEPS];            // step -> Q8.8 dB
+static char s_db_str[FADER_STEPS][6];       // step -> display text
+static int s_ready = 0;
+
+// The console's law and its inverse, in floating point
+static float taper_db(float f)
+{
+    if (f >= 0.5f)    return 40.0f * f - 30.0f;
+    if (f >= 0.25f)   return 80.0f * f - 50.0f;
+    if (f >= 0.0625f) return 160.0f * f - 70.0f;
+    return 480.0f * f - 90.0f;
+}
+
+static float taper_value(float db)
+{
+    if (db >= -10.0f) return (db + 30.0f) / 40.0f;
+    if (db >= -30.0f) return (db + 50.0f) / 80.0f;
+    if (db >= -60.0f) return (db + 70.0f) / 160.0f;
+    return (db + 90.0f) / 480.0f;
+}
+
+void fader_taper_init(void)
+{
+    if (s_ready) return;
+
+    s_db_q8[0] = FADER_DB_Q8_OFF;
+    snprintf(s_db_str[0], sizeof(s_db_str[0]), "-inf");
+
+    for (int i = 1; i < FADER_STEPS; i++) {
+        float db = taper_db((float)i / (FADER_STEPS - 1));
+        s_db_q8[i] = (s16)lroundf(db * 256.0f);
+        snprintf(s_db_str[i], sizeof(s_db_str[i]), "%d", (int)lroundf(db));
+    }
+
+    s_ready = 1;
+}
+
+// ============================================================================
+// LOOKUPS
+// ============================================================================
+
+int fader_value_to_step(float value)
+{
+    if (!(value > 0.0f)) return 0;      // Also catches NaN
+    if (value >= 1.0f) return FADER_STEPS - 1;
+    return (int)(value * (FADER_STEPS - 1) + 0.5f);
+}
+
+float fader_step_to_value(int step)
+{
+    if (step <= 0) return 0.0f;
+    if (step >= FADER_STEPS - 1) return 1.0f;
+    return (float)step / (FADER_STEPS - 1);
+}
+
+s16 fader_step_to_db_q8(int step)
+{
+    if (step <= 0) return FADER_DB_Q8_OFF;
+    if (step >= FADER_STEPS) step = FADER_STEPS - 1;
+    return s_db_q8[step];
+}
+
+float fader_step_to_db(int step)
+{
+    if (step <= 0) return -INFINITY;
+    if (step >= FADER_STEPS) step = FADER_STEPS - 1;
+    return s_db_q8[step] * (1.0f / 256.0f);
+}
+
+int fader_db_to_step(float db)
+{
+    if (!(db > FADER_DB_MIN)) return 0;  // -inf, NaN and anything at the floor
+    if (db >= FADER_DB_MAX) return FADER_STEPS - 1;
+
+    // One segment test and a multiply: exact inverse of the table
+    int step = (int)(taper_value(db) * (FADER_STEPS - 1) + 0.5f);
+    return (step < 1) ? 1 : step;
+}
+
+float fader_db_to_value(float db)
+{
+    return fader_step_to_value(fader_db_to_step(db));
+}
+
+const char *fader_step_to_string(int step)
+{
+    if (step <= 0) return s_db_str[0];
+    if (step >= FADER_STEPS) step = FADER_STEPS - 1;
+    return s_db_str[step];
+}
@@ -0,0 +1,38 @@
+#ifndef FADER_TAPER_H
+#define FADER_TAPER_H
+
+#include "platform.h"
+
+// ============================================================================
+// X18 FADER TAPER
+// ============================================================================
+// The console quantizes /ch/XX/mix/fader to 1024 steps and maps them to dB
+// with a 4-segment law (f = step / 1023):
+//
+//   f >= 0.5     dB = 40f - 30      (-10 .. +10)
+//   f >= 0.25    dB = 80f - 50      (-30 .. -10)
+//   f >= 0.0625  dB = 160f - 70     (-60 .. -30)
+//   f >  0       dB = 480f - 90     (-90 .. -60)
+//   f == 0       -inf
+//
+// Tables are built once by fader_taper_init(); every lookup is O(1).
+// dB values are stored as Q8.8 fixed point.
+
+#define FADER_STEPS         1024
+#define FADER_DB_MIN        -90.0f
+#define FADER_DB_MAX        10.0f
+#define FADER_DB_Q8_OFF     INT16_MIN   // Q8.8 value used for -inf
+
+void fader_taper_init(void);
+
+int fader_value_to_step(float value);       // 0..1 -> 0..1023 (nearest)
+float fader_step_to_value(int step);        // 0..1023 -> 0..1
+
+s16 fader_step_to_db_q8(int step);          // Q8.8 dB, FADER_DB_Q8_OFF at step 0
+float fader_step_to_db(int step);           // dB, -INFINITY at step 0
+int fader_db_to_step(float db);             // Nearest step, 0 at or below FADER_DB_MIN
+float fader_db_to_value(float db);
+
+const char *fader_step_to_string(int step); // Cached display text ("-inf", "-12", "5")
+
+#endif
@@ -0,0 +1,243 @@
+#include <string.h>
+#include <stdlib.h>
+
+#include "log.h"
+#include "fader_taper.h"
+#include "show.h"
+#include "options.h"
+#include "cue_engine.h"
+#include "osc.h"
+#include "osc_query.h"
+#include "go_verify.h"
+
+#define VERIFY_FIXED_PER_CH     (2 + 5 * 4)     // Fader, mute, 4 params x 5 bands (EQ on is not sent)
+#define VERIFY_FLUSH_MS         2000
+
+static Thread s_thread = NULL;
+static LightEvent s_wake;
+static LightLock s_lock;            // Guards the request and the stats
+static volatile int s_exit = 0;
+
+static int s_req_step = -1;
+static volatile u32 s_req_seq = 0;
+static GoVerifyStats s_stats;
+
+// ============================================================================
+// EXPECTED STATE
+// ============================================================================
+
+// What send_step_osc() recalls for the step, as (id, console step) pairs.
+// Show lock held.
+static int build_expected(const Step *step, u16 fading, u16 *ids, int *expect)
+{
+    static const u8 band_templates[4] = { PT_CH_EQ_TYPE, PT_CH_EQ_F, PT_CH_EQ_G, PT_CH_EQ_Q };
+    u16 channels = (u16)~(step->released_channels | g_current_show.channel_safes);
+    u8 groups = (u8)(~step->released_groups & STEP_SCOPE_ALL);
+    int n = 0;
+
+    for (int ch = 0; ch < 16; ch++) {
+        if (!(channels & (1 << ch))) continue;
+
+        if (g_options.send_fader && (groups & STEP_SCOPE_FADER) && !(fading & (1 << ch))) {
+            ids[n] = PARAM_ID(PT_CH_MIX_FADER, ch, 0);
+            expect[n++] = fader_value_to_step(step->volumes[ch]);
+        }
+        if (groups & STEP_SCOPE_MUTE) {
+            ids[n] = PARAM_ID(PT_CH_MIX_ON, ch, 0);
+            expect[n++] = step->mutes[ch] ? 0 : 1;
+        }
+        const ChannelEQ *eq = &step->eqs[ch];
+        if (g_options.send_eq && (groups & STEP_SCOPE_EQ) && eq->enabled) {
+            for (int band = 0; band < 5; band++) {
+                const EQBand *b = &eq->bands[band];
+                const float values[4] = { (float)b->type, b->frequency, b->gain, b->q_factor };
+                for (int p = 0; p < 4; p++) {
+                    u16 id = PARAM_ID(band_templates[p], ch, band);
+                    ids[n] = id;
+                    expect[n++] = (p == 0) ? (int)b->type : param_value_to_step(id, values[p]);
+                }
+            }
+        }
+    }
+
+    if (groups & STEP_SCOPE_PARAMS) {
+        for (int i = 0; i < step->params.count; i++) {
+            int ch = param_channel(step->params.items[i].id);
+            if (ch >= 0 && !(channels & (1 << ch))) continue;
+            ids[n] = step->params.items[i].id;
+            expect[n++] = step->params.items[i].step;
+        }
+    }
+    return n;
+}
+
+// ============================================================================
+// VERIFY THREAD
+// ============================================================================
+
+static void sleep_ms(u32 ms)
+{
+    svcSleepThread((s64)ms * 1000000LL);
+}
+
+static int superseded(u32 seq)
+{
+    return s_exit || s_req_seq != seq;
+}
+
+static void verify_go(int step_idx, u32 seq)
+{
+    u64 start = svcGetSystemTick();
+    GoVerifyStats result;
+    memset(&result, 0, sizeof(result));
+    result.step_idx = step_idx;
+
+    // Let the paced burst go out and the console apply it before reading back
+    osc_pacer_flush(osc_pacer(), VERIFY_FLUSH_MS);
+    sleep_ms(VERIFY_SETTLE_MS);
+    if (superseded(seq)) return;
+
+    cue_lock_show();
+    if (step_idx >= g_current_show.num_steps) {
+        cue_unlock_show();
+        return;
+    }
+    const Step *step = &g_current_show.steps[step_idx];
+    int max = 16 * VERIFY_FIXED_PER_CH + step->params.count;
+    u16 *ids = (u16 *)malloc(max * sizeof(u16));
+    int *expect = (int *)malloc(max * sizeof(int));
+    int *got = (int *)malloc(max * sizeof(int));
+    u32 *mismatch = (u32 *)malloc(((max + 31) / 32) * sizeof(u32));
+    int n = 0;
+    if (ids && expect && got && mismatch) {
+        n = build_expected(step, cue_fades_active(), ids, expect);
+    }
+    cue_unlock_show();
+    result.checked = n;
+
+    for (int round = 0; n > 0; round++) {
+        osc_query_params(ids, n, got, VERIFY_WINDOW, VERIFY_TIMEOUT_MS, 0, NULL);
+        if (superseded(seq)) {
+            result.cancelled = 1;
+            break;
+        }
+
+        // A bit per parameter the console does not hold (or did not answer)
+        int wrong = 0;
+        memset(mismatch, 0, ((n + 31) / 32) * sizeof(u32));
+        for (int i = 0; i < n; i++) {
+            if (got[i] != expect[i]) {
+                mismatch[i >> 5] |= 1u << (i & 31);
+                wrong++;
+            }
+        }
+        if (round == 0) result.lost = wrong;
+        result.rounds = round + 1;
+        if (wrong == 0) break;
+        if (round == VERIFY_MAX_ROUNDS) {
+            result.unresolved = wrong;
+            break;
+        }
+
+        // Resend only the mismatches and keep just those for the next pass
+        int kept = 0;
+        for (int i = 0; i < n; i++) {
+            if (!(mismatch[i >> 5] & (1u << (i & 31)))) continue;
+            osc_send_param(ids[i], expect[i]);
+            result.resent++;
+            ids[kept] = ids[i];
+            expect[kept] = expect[i];
+            kept++;
+        }
+        n = kept;
+        osc_pacer_flush(osc_pacer(), VERIFY_FLUSH_MS);
+        sleep_ms(VERIFY_SETTLE_MS);
+    }
+
+    free(ids);
+    free(expect);
+    free(got);
+    free(mismatch);
+
+    result.elapsed_ms = (u32)((svcGetSystemTick() - start) / CPU_TICKS_PER_MSEC);
+    if (result.lost || result.cancelled) {
+        LOG_INFO("[VERIFY] Step %d: %u/%u wrong, %u resent, %u unresolved%s", step_idx + 1,
+                 result.lost, result.checked, result.resent, result.unresolved,
+                 result.cancelled ? " (cancelled)" : "");
+    }
+
+    // Loss on the first pass steers the pacer's rate
+    if (!result.cancelled) osc_pacer_report_loss(osc_pacer(), result.checked, result.lost);
+
+    LightLock_Lock(&s_lock);
+    result.total_checked = s_stats.total_checked + result.checked;
+    result.total_lost = s_stats.total_lost + result.lost;
+    s_stats = result;
+    LightLock_Unlock(&s_lock);
+}
+
+static void verify_thread_main(void *arg)
+{
+    (void)arg;
+    while (!s_exit) {
+        LightEvent_Wait(&s_wake);
+        if (s_exit) break;
+
+        LightLock_Lock(&s_lock);
+        int step_idx = s_req_step;
+        u32 seq = s_req_seq;
+        LightLock_Unlock(&s_lock);
+
+        if (step_idx >= 0) verify_go(step_idx, seq);
+    }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void go_verify_init(void)
+{
+    LightLock_Init(&s_lock);
+    LightEvent_Init(&s_wake, RESET_ONESHOT);
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.step_idx = -1;
+
+    // Below the main loop: checking is never urgent, the GO already went out
+    s_exit = 0;
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    s_thread = threadCreate(verify_thread_main, NULL, 8 * 1024, prio + 1, -2, false);
+    if (!s_thread) {
+        LOG_ERROR("[VERIFY] Verify thread not started");
+    }
+}
+
+void go_verify_shutdown(void)
+{
+    if (s_thread) {
+        s_exit = 1;
+        LightEvent_Signal(&s_wake);
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    }
+}
+
+void go_verify_request(int step_idx)
+{
+    if (!g_options.verify_go || !s_thread) return;
+
+    LightLock_Lock(&s_lock);
+    s_req_step = step_idx;
+    s_req_seq++;
+    LightLock_Unlock(&s_lock);
+    LightEvent_Signal(&s_wake);
+}
+
+void go_verify_stats(GoVerifyStats *out)
+{
+    LightLock_Lock(&s_lock);
+    *out = s_stats;
+    LightLock_Unlock(&s_lock);
+}
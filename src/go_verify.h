@@ -0,0 +1,44 @@
+#ifndef GO_VERIFY_H
+#define GO_VERIFY_H
+
+#include "platform.h"
+
+// ============================================================================
+// GO VERIFICATION
+// ============================================================================
+// UDP sends that get lost on stage Wi-Fi leave the console in the wrong
+// state without anyone noticing. With verification on (verify=1 in
+// [OSC_SEND]), every GO is followed by a background check: after
+// VERIFY_SETTLE_MS the parameters the step recalled are read back with
+// pipelined queries, compared against the step in a mismatch bitmap, and only
+// the mismatches are sent again. This repeats until everything matches or
+// VERIFY_MAX_ROUNDS have passed. Channels still fading are left out. A newer
+// GO cancels the check in progress. The first-pass loss is reported to the
+// pacer (osc_pacer.h), which adapts its rate to it.
+
+#define VERIFY_SETTLE_MS    40
+#define VERIFY_MAX_ROUNDS   3       // Retransmit budget per GO
+#define VERIFY_WINDOW       16
+#define VERIFY_TIMEOUT_MS   60
+
+typedef struct {
+    int step_idx;           // Last verified GO, -1 before the first
+    u16 checked;            // Parameters compared
+    u16 lost;               // Wrong or unanswered on the first pass
+    u16 resent;             // Retransmissions, all rounds
+    u16 unresolved;         // Still wrong when the budget ran out
+    u8 rounds;
+    u8 cancelled;           // A newer GO took over
+    u32 elapsed_ms;
+    u32 total_checked;      // Since start-up
+    u32 total_lost;
+} GoVerifyStats;
+
+void go_verify_init(void);
+void go_verify_shutdown(void);
+
+// Cue engine, after a step was sent (show lock held)
+void go_verify_request(int step_idx);
+void go_verify_stats(GoVerifyStats *out);
+
+#endif
@@ -0,0 +1,250 @@
+#include "input.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "log.h"
+
+static InputFrame s_frame;
+static u32 s_frames = 0;
+static int s_ended = 0;
+
+static InputSource s_source = NULL;
+static void *s_source_ctx = NULL;
+
+static FILE *s_replay = NULL;
+static InputFrame s_replay_last;
+static int s_replay_run = 0;            // Frames left in the current run
+
+static FILE *s_record = NULL;
+static InputFrame s_record_last;
+static int s_record_run = 0;            // Frames not yet written
+
+// ============================================================================
+// FILE CODING
+// ============================================================================
+
+static void put_le(u8 *out, u32 v, int bytes)
+{
+    for (int i = 0; i < bytes; i++) {
+        out[i] = (u8)(v >> (8 * i));
+    }
+}
+
+static int read_le(FILE *f, u32 *out, int bytes)
+{
+    u8 buf[4];
+    if (fread(buf, 1, bytes, f) != (size_t)bytes) return 0;
+    *out = 0;
+    for (int i = bytes - 1; i >= 0; i--) {
+        *out = (*out << 8) | buf[i];
+    }
+    return 1;
+}
+
+static void record_flush_run(void)
+{
+    if (s_record_run > 0) {
+        fputc(INPUT_REC_RUN | s_record_run, s_record);
+        s_record_run = 0;
+    }
+}
+
+static void record_frame(const InputFrame *f)
+{
+    int same_touch = f->touch_x == s_record_last.touch_x && f->touch_y == s_record_last.touch_y;
+    if (f->down == 0 && f->held == s_record_last.held && same_touch) {
+        if (++s_record_run == INPUT_RUN_MAX) record_flush_run();
+        return;
+    }
+    record_flush_run();
+
+    u8 rec[1 + 4 + 4 + 4];
+    int n = 1;
+    rec[0] = 0;
+    if (f->down) {
+        rec[0] |= INPUT_REC_DOWN;
+        put_le(rec + n, f->down, 4);
+        n += 4;
+    }
+    if (f->held != s_record_last.held) {
+        rec[0] |= INPUT_REC_HELD;
+        put_le(rec + n, f->held, 4);
+        n += 4;
+    }
+    if (!same_touch) {
+        rec[0] |= INPUT_REC_TOUCH;
+        put_le(rec + n, f->touch_x, 2);
+        put_le(rec + n + 2, f->touch_y, 2);
+        n += 4;
+    }
+    fwrite(rec, 1, n, s_record);
+    s_record_last = *f;
+}
+
+// One record into s_replay_last / s_replay_run; 0 at the end of the file
+static int replay_read(void)
+{
+    int mask = fgetc(s_replay);
+    if (mask == EOF) return 0;
+    if (mask & INPUT_REC_RUN) {
+        s_replay_run = mask & INPUT_RUN_MAX;
+        s_replay_last.down = 0;
+        return s_replay_run > 0;
+    }
+
+    u32 v;
+    s_replay_last.down = 0;
+    if (mask & INPUT_REC_DOWN) {
+        if (!read_le(s_replay, &v, 4)) return 0;
+        s_replay_last.down = v;
+    }
+    if (mask & INPUT_REC_HELD) {
+        if (!read_le(s_replay, &v, 4)) return 0;
+        s_replay_last.held = v;
+    }
+    if (mask & INPUT_REC_TOUCH) {
+        if (!read_le(s_replay, &v, 2)) return 0;
+        s_replay_last.touch_x = (u16)v;
+        if (!read_le(s_replay, &v, 2)) return 0;
+        s_replay_last.touch_y = (u16)v;
+    }
+    s_replay_run = 1;
+    return 1;
+}
+
+// InputSource over a recording
+static int replay_next(void *ctx, InputFrame *frame)
+{
+    (void)ctx;
+    if (!s_replay) return 0;
+
+    if (s_replay_run == 0 && !replay_read()) {
+        fclose(s_replay);
+        s_replay = NULL;
+        return 0;
+    }
+    s_replay_run--;
+    *frame = s_replay_last;
+    // Only the first frame of a record can press a key
+    s_replay_last.down = 0;
+    return 1;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void input_set_source(InputSource source, void *ctx)
+{
+    s_source = source;
+    s_source_ctx = ctx;
+    s_ended = 0;
+}
+
+int input_replay_open(const char *path)
+{
+    if (s_replay) fclose(s_replay);
+    s_replay = fopen(path, "rb");
+    if (!s_replay) {
+        LOG_WARN("[INPUT] Cannot open %s", path);
+        return 0;
+    }
+
+    u8 header[INPUT_HEADER_SIZE];
+    if (fread(header, 1, sizeof(header), s_replay) != sizeof(header) ||
+        memcmp(header, INPUT_MAGIC, 4) != 0 || header[4] != INPUT_VERSION) {
+        LOG_WARN("[INPUT] %s is not an input recording", path);
+        fclose(s_replay);
+        s_replay = NULL;
+        return 0;
+    }
+
+    memset(&s_replay_last, 0, sizeof(s_replay_last));
+    s_replay_run = 0;
+    input_set_source(replay_next, NULL);
+    LOG_INFO("[INPUT] Replaying %s", path);
+    return 1;
+}
+
+int input_scan(void)
+{
+    if (s_ended) {
+        memset(&s_frame, 0, sizeof(s_frame));
+    } else if (s_source) {
+        if (!s_source(s_source_ctx, &s_frame)) {
+            s_ended = 1;
+            memset(&s_frame, 0, sizeof(s_frame));
+        }
+    } else {
+        platform_input_read(&s_frame.down, &s_frame.held, &s_frame.touch_x, &s_frame.touch_y);
+    }
+
+    if (s_record && !s_ended) record_frame(&s_frame);
+    s_frames++;
+    return !s_ended;
+}
+
+int input_source_ended(void)
+{
+    return s_ended;
+}
+
+u32 input_frame_count(void)
+{
+    return s_frames;
+}
+
+u32 input_keys_down(void)
+{
+    return s_frame.down;
+}
+
+u32 input_keys_held(void)
+{
+    return s_frame.held;
+}
+
+void input_touch(u16 *x, u16 *y)
+{
+    *x = s_frame.touch_x;
+    *y = s_frame.touch_y;
+}
+
+int input_record_start(void)
+{
+    if (s_record) return 1;
+
+    mkdir(PLATFORM_DATA_DIR, 0777);
+    remove(INPUT_RECORD_PREV_PATH);
+    rename(INPUT_RECORD_PATH, INPUT_RECORD_PREV_PATH);
+    s_record = fopen(INPUT_RECORD_PATH, "wb");
+    if (!s_record) {
+        LOG_WARN("[INPUT] Cannot create %s", INPUT_RECORD_PATH);
+        return 0;
+    }
+    // Idle frames cost a byte per 127, so the buffer reaches the SD card rarely
+    static char io_buf[4096];
+    setvbuf(s_record, io_buf, _IOFBF, sizeof(io_buf));
+
+    u8 header[INPUT_HEADER_SIZE];
+    memset(header, 0, sizeof(header));
+    memcpy(header, INPUT_MAGIC, 4);
+    header[4] = INPUT_VERSION;
+    fwrite(header, 1, sizeof(header), s_record);
+
+    memset(&s_record_last, 0, sizeof(s_record_last));
+    s_record_run = 0;
+    LOG_INFO("[INPUT] Recording input to %s", INPUT_RECORD_PATH);
+    return 1;
+}
+
+void input_record_stop(void)
+{
+    if (!s_record) return;
+    record_flush_run();
+    fclose(s_record);
+    s_record = NULL;
+    LOG_INFO("[INPUT] Recording stopped after %lu frames", (unsigned long)s_frames);
+}
@@ -0,0 +1,76 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include "platform.h"
+
+// ============================================================================
+// INPUT EVENT STREAM
+// ============================================================================
+// The main loop reads buttons and touch once per frame through input_scan()
+// instead of hidKeysDown()/hidKeysHeld()/hidTouchRead(), so the frames can
+// come from somewhere else than the console:
+//
+//   live      platform_input_read() (the HID service on the 3DS)
+//   replay    a file written by input_record_start(), frame by frame
+//   source    any InputSource, e.g. the scripted sessions of the headless
+//             host build (host/headless/)
+//
+// Key masks are libctru's KEY_* bits whatever the source. The touch position
+// is what hidTouchRead() reports, (0, 0) when the screen is not touched.
+//
+// A replay repeats the input frame for frame. Time is not replayed, so what
+// the cue engine and the network do between frames can differ from run to
+// run (docs/HOST_BUILD.md).
+//
+// With [INPUT] record=1 in Options every frame of the session goes to
+// INPUT_RECORD_PATH (the previous session is kept as INPUT_RECORD_PREV_PATH).
+//
+// File layout: "X18I", u8 version, u8 reserved[3], then one record per frame
+// or run of frames, little-endian:
+//
+//   u8 0x80 | n           n frames (1-127) that repeat the last held keys
+//                         and touch, with nothing newly pressed
+//   u8 mask               one frame; the fields whose bit is set follow:
+//     INPUT_REC_DOWN        u32 keys down
+//     INPUT_REC_HELD        u32 keys held
+//     INPUT_REC_TOUCH       u16 x, u16 y
+
+#define INPUT_RECORD_PATH       PLATFORM_DATA_DIR "/input.x18i"
+#define INPUT_RECORD_PREV_PATH  PLATFORM_DATA_DIR "/input.prev.x18i"
+#define INPUT_MAGIC             "X18I"
+#define INPUT_VERSION           1
+#define INPUT_HEADER_SIZE       8
+
+#define INPUT_REC_DOWN          0x01
+#define INPUT_REC_HELD          0x02
+#define INPUT_REC_TOUCH         0x04
+#define INPUT_REC_RUN           0x80
+#define INPUT_RUN_MAX           127
+
+typedef struct {
+    u32 down;               // Pressed this frame
+    u32 held;
+    u16 touch_x;
+    u16 touch_y;
+} InputFrame;
+
+// Next frame into *frame; 0 when the source has no more
+typedef int (*InputSource)(void *ctx, InputFrame *frame);
+
+void input_set_source(InputSource source, void *ctx);  // NULL: live input
+int input_replay_open(const char *path);    // Replay a recording (closes at its end)
+
+// Once per frame, before anything reads input. Returns 0 (and a frame with
+// nothing pressed) once the source has run out.
+int input_scan(void);
+int input_source_ended(void);
+u32 input_frame_count(void);                // Frames scanned so far
+
+u32 input_keys_down(void);
+u32 input_keys_held(void);
+void input_touch(u16 *x, u16 *y);
+
+int input_record_start(void);               // Keeps the last recording as INPUT_RECORD_PREV_PATH
+void input_record_stop(void);
+
+#endif
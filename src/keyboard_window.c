@@ -1,4 +1,5 @@
 #include "common.h"
+#include "input.h"
 #include "keyboard_window.h"
 
 void render_keyboard(void)
@@ -85,7 +86,7 @@ extern void list_available_shows(void);
 
 void handle_new_show_input(void)
 {
-    u32 kDown = hidKeysDown();
+    u32 kDown = input_keys_down();
     int touch_edge = g_isTouched && !g_wasTouched;
     
     // Handle button press input (A/B for quick confirm/cancel)
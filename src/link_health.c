@@ -0,0 +1,344 @@
+#include <string.h>
+#include <poll.h>
+#include <sys/socket.h>
+
+#include "log.h"
+#include "osc.h"
+#include "osc_query.h"
+#include "osc_targets.h"
+#include "osc_capture.h"
+#include "link_health.h"
+
+#define HEALTH_MIN_US           64      // Bucket 0 holds everything up to this
+#define HEALTH_DEGRADED_LOSS    10      // Percent
+#define HEALTH_DEGRADED_P99_US  100000
+
+static Thread s_thread = NULL;
+static Thread s_target_thread = NULL;  // Above the main loop: target replies are timed on arrival
+static LightEvent s_wake;
+static LightEvent s_target_go;
+static LightEvent s_target_done;
+static volatile int s_target_count = 0;
+static LightLock s_lock;            // Guards everything below
+static volatile int s_exit = 0;
+
+// Sliding window: one entry per probe, the RTT bucket or -1 for a lost probe
+typedef struct {
+    s8 window[HEALTH_WINDOW];
+    int head;
+    int count;
+    int misses;                     // Consecutive unanswered probes
+    int answered_ever;
+    LinkHealth health;
+} HealthTracker;
+
+// One per target (osc_targets.h), 0 is the mixer
+static HealthTracker s_trackers[OSC_MAX_TARGETS];
+
+// ============================================================================
+// /xinfo REPLY
+// ============================================================================
+
+static int osc_pad4(int n)
+{
+    return (n + 4) & ~3;
+}
+
+// Copy the NUL-terminated string at *pos and step over its padding
+static int read_string(const u8 *packet, int len, int *pos, char *out, int out_max)
+{
+    int n = 0;
+    while (*pos + n < len && packet[*pos + n] != 0) {
+        if (n < out_max - 1) out[n] = (char)packet[*pos + n];
+        n++;
+    }
+    if (*pos + n >= len) return 0;
+    out[(n < out_max - 1) ? n : out_max - 1] = '\0';
+    *pos += osc_pad4(n);
+    return 1;
+}
+
+int xinfo_parse(const u8 *packet, int len, MixerInfo *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (len < 12 || memcmp(packet, "/xinfo\0", 7) != 0) return 0;
+
+    int pos = 8;
+    if (memcmp(packet + pos, ",ssss", 5) != 0) return 0;
+    pos += 8;
+
+    return read_string(packet, len, &pos, out->ip, sizeof(out->ip)) &&
+           read_string(packet, len, &pos, out->name, sizeof(out->name)) &&
+           read_string(packet, len, &pos, out->model, sizeof(out->model)) &&
+           read_string(packet, len, &pos, out->firmware, sizeof(out->firmware));
+}
+
+// ============================================================================
+// HISTOGRAM
+// ============================================================================
+
+// Four buckets per octave above HEALTH_MIN_US: bucket b ends at 64us * 2^(b/4)
+u32 link_health_bucket_us(int bucket)
+{
+    static const u16 quarter[4] = { 1000, 1189, 1414, 1682 };    // 2^(k/4) * 1000
+    if (bucket < 0) bucket = 0;
+    if (bucket >= HEALTH_BUCKETS) bucket = HEALTH_BUCKETS - 1;
+    u64 us = ((u64)HEALTH_MIN_US << (bucket / 4)) * quarter[bucket % 4] / 1000;
+    return (us > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (u32)us;
+}
+
+static int bucket_of(u32 us)
+{
+    int b = 0;
+    while (b < HEALTH_BUCKETS - 1 && us > link_health_bucket_us(b)) b++;
+    return b;
+}
+
+// Lock held
+static u32 percentile(const LinkHealth *h, int pct)
+{
+    u32 answered = h->probes - h->lost;
+    if (answered == 0) return 0;
+
+    u32 rank = (answered * pct + 99) / 100;
+    u32 seen = 0;
+    for (int b = 0; b < HEALTH_BUCKETS; b++) {
+        seen += h->histogram[b];
+        if (seen >= rank) return link_health_bucket_us(b);
+    }
+    return link_health_bucket_us(HEALTH_BUCKETS - 1);
+}
+
+// Lock held
+static void record_probe(int target, int answered, u32 rtt_us)
+{
+    HealthTracker *t = &s_trackers[target];
+    LinkHealth *h = &t->health;
+
+    // Drop the oldest probe once the window is full
+    if (t->count == HEALTH_WINDOW) {
+        s8 old = t->window[t->head];
+        if (old < 0) h->lost--;
+        else h->histogram[(int)old]--;
+        h->probes--;
+        t->count--;
+        t->head = (t->head + 1) % HEALTH_WINDOW;
+    }
+
+    s8 entry = answered ? (s8)bucket_of(rtt_us) : -1;
+    t->window[(t->head + t->count) % HEALTH_WINDOW] = entry;
+    t->count++;
+    h->probes++;
+    if (answered) {
+        h->histogram[(int)entry]++;
+        h->last_us = rtt_us;
+        t->misses = 0;
+        t->answered_ever = 1;
+    } else {
+        h->lost++;
+        t->misses++;
+    }
+
+    h->p50_us = percentile(h, 50);
+    h->p99_us = percentile(h, 99);
+
+    LinkState state;
+    if (t->misses >= HEALTH_DEAD_AFTER) state = LINK_DEAD;
+    else if (!t->answered_ever) state = LINK_UNKNOWN;
+    else if (h->lost * 100 > h->probes * HEALTH_DEGRADED_LOSS ||
+             h->p99_us > HEALTH_DEGRADED_P99_US) state = LINK_DEGRADED;
+    else state = LINK_GOOD;
+
+    if (state != h->state) {
+        OscTargetStats target_info;
+        osc_target_stats(target, &target_info);
+        if (state == LINK_DEAD) LOG_WARN("[LINK] No answer from %s for %d probes", target_info.host, t->misses);
+        else LOG_INFO("[LINK] %s %s: p50 %lu us, p99 %lu us, %u/%u lost", target_info.host,
+                      state == LINK_GOOD ? "good" : state == LINK_DEGRADED ? "degraded" : "unknown",
+                      (unsigned long)h->p50_us, (unsigned long)h->p99_us, h->lost, h->probes);
+        h->state = state;
+    }
+}
+
+static void reset_tracker(HealthTracker *t)
+{
+    memset(t, 0, sizeof(*t));
+    t->health.state = LINK_UNKNOWN;
+}
+
+// ============================================================================
+// PROBE THREAD
+// ============================================================================
+
+static void store_probe(int target, int answered, u32 rtt_us, const MixerInfo *info)
+{
+    LightLock_Lock(&s_lock);
+    record_probe(target, answered, rtt_us);
+    if (answered) s_trackers[target].health.mixer = *info;
+    LightLock_Unlock(&s_lock);
+}
+
+// The extra targets, all at once on their own sockets
+static void probe_targets(int count)
+{
+    static const u8 xinfo[8] = { '/', 'x', 'i', 'n', 'f', 'o', 0, 0 };
+    struct pollfd pfds[OSC_MAX_TARGETS];
+    u32 rtt_us[OSC_MAX_TARGETS];
+    int answered[OSC_MAX_TARGETS];
+    MixerInfo info[OSC_MAX_TARGETS];
+    int pending = 0;
+
+    u64 start = svcGetSystemTick();
+    for (int i = 1; i < count; i++) {
+        pfds[i].fd = osc_target_socket(i);
+        pfds[i].events = POLLIN;
+        pfds[i].revents = 0;
+        rtt_us[i] = 0;
+        answered[i] = 0;
+        osc_target_send(i, xinfo, sizeof(xinfo));
+        pending++;
+    }
+
+    u64 deadline = start + (u64)(HEALTH_TIMEOUT_MS * CPU_TICKS_PER_MSEC);
+    while (pending > 0 && !s_exit) {
+        u64 now = svcGetSystemTick();
+        if (now >= deadline) break;
+        int wait_ms = (int)((deadline - now) / CPU_TICKS_PER_MSEC) + 1;
+        if (poll(&pfds[1], count - 1, wait_ms) <= 0) continue;
+
+        u8 reply[OSC_REPLY_MAX];
+        for (int i = 1; i < count; i++) {
+            if (!(pfds[i].revents & POLLIN)) continue;
+            int len = recv(pfds[i].fd, reply, sizeof(reply), 0);
+            if (len > 0) osc_capture_packet(i, 1, reply, len);
+            if (answered[i] || len <= 0 || !xinfo_parse(reply, len, &info[i])) continue;
+            rtt_us[i] = (u32)((svcGetSystemTick() - start) / CPU_TICKS_PER_USEC);
+            answered[i] = 1;
+            pending--;
+        }
+    }
+
+    for (int i = 1; i < count && !s_exit; i++) {
+        store_probe(i, answered[i], rtt_us[i], &info[i]);
+    }
+}
+
+static void health_thread_main(void *arg)
+{
+    (void)arg;
+    u8 reply[OSC_REPLY_MAX];
+
+    while (!s_exit) {
+        if (g_osc_connected) {
+            // Straight to the socket, not through the pacer: the RTT is the link's.
+            // The reply is timed by the receive thread, not when this one wakes
+            u32 rtt_us = 0;
+            int len = osc_query_timed("/xinfo", reply, sizeof(reply), HEALTH_TIMEOUT_MS, &rtt_us);
+            if (s_exit) break;
+
+            MixerInfo info;
+            store_probe(0, len > 0 && xinfo_parse(reply, len, &info), rtt_us, &info);
+        }
+
+        int count = osc_target_count();
+        if (count > 1 && s_target_thread) {
+            s_target_count = count;
+            LightEvent_Signal(&s_target_go);
+            LightEvent_Wait(&s_target_done);
+        } else if (count > 1) {
+            probe_targets(count);
+        }
+
+        LightEvent_WaitTimeout(&s_wake, (s64)HEALTH_PERIOD_MS * 1000000LL);
+    }
+}
+
+// Sends and receives the target probes above the main loop; it only runs
+// while replies come in
+static void target_thread_main(void *arg)
+{
+    (void)arg;
+    while (1) {
+        LightEvent_Wait(&s_target_go);
+        if (s_exit) break;
+        probe_targets(s_target_count);
+        LightEvent_Signal(&s_target_done);
+    }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void link_health_reset(void)
+{
+    LightLock_Lock(&s_lock);
+    for (int i = 0; i < OSC_MAX_TARGETS; i++) {
+        reset_tracker(&s_trackers[i]);
+    }
+    LightLock_Unlock(&s_lock);
+
+    // Probe the new address right away
+    if (s_thread) LightEvent_Signal(&s_wake);
+}
+
+void link_health_init(void)
+{
+    LightLock_Init(&s_lock);
+    LightEvent_Init(&s_wake, RESET_ONESHOT);
+    LightEvent_Init(&s_target_go, RESET_ONESHOT);
+    LightEvent_Init(&s_target_done, RESET_ONESHOT);
+    link_health_reset();
+
+    // Below the main loop: a probe in flight must never hold up a frame
+    s_exit = 0;
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    s_thread = threadCreate(health_thread_main, NULL, 8 * 1024, prio + 1, -2, false);
+    if (!s_thread) {
+        LOG_ERROR("[LINK] Health thread not started");
+        return;
+    }
+    s_target_thread = threadCreate(target_thread_main, NULL, 8 * 1024, prio - 1, -2, false);
+    if (!s_target_thread) {
+        LOG_WARN("[LINK] Target probe thread not started, target RTTs include main loop time");
+    }
+}
+
+void link_health_shutdown(void)
+{
+    if (s_thread) {
+        s_exit = 1;
+        LightEvent_Signal(&s_wake);
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    }
+    if (s_target_thread) {
+        LightEvent_Signal(&s_target_go);
+        threadJoin(s_target_thread, U64_MAX);
+        threadFree(s_target_thread);
+        s_target_thread = NULL;
+    }
+}
+
+void link_health_get(LinkHealth *out)
+{
+    link_health_get_target(0, out);
+}
+
+void link_health_get_target(int target, LinkHealth *out)
+{
+    if (target < 0 || target >= OSC_MAX_TARGETS) target = 0;
+    LightLock_Lock(&s_lock);
+    *out = s_trackers[target].health;
+    LightLock_Unlock(&s_lock);
+}
+
+LinkState link_health_state(void)
+{
+    LightLock_Lock(&s_lock);
+    LinkState state = s_trackers[0].health.state;
+    LightLock_Unlock(&s_lock);
+    return state;
+}
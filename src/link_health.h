@@ -0,0 +1,67 @@
+#ifndef LINK_HEALTH_H
+#define LINK_HEALTH_H
+
+#include "platform.h"
+
+// ============================================================================
+// LINK HEALTH MONITOR
+// ============================================================================
+// g_osc_connected only says the address parsed. A probe thread sends
+// /xinfo every HEALTH_PERIOD_MS (off the render loop) and times the reply.
+// The last HEALTH_WINDOW probes feed a loss rate and an RTT histogram with
+// quarter-octave buckets, from which p50/p99 are read.
+//
+//   LINK_UNKNOWN    no probe answered yet (or no address)
+//   LINK_GOOD
+//   LINK_DEGRADED   loss above 10% or p99 above 100 ms in the window
+//   LINK_DEAD       the last HEALTH_DEAD_AFTER probes all went unanswered
+//
+// Every fan-out target (osc_targets.h) is tracked the same way; after the
+// mixer's probe, the extra targets are probed together on their own sockets.
+// Replies are timed where they are received, above the main loop, so a busy
+// frame does not show up as link latency.
+
+#define HEALTH_PERIOD_MS    1000
+#define HEALTH_TIMEOUT_MS   500
+#define HEALTH_WINDOW       60
+#define HEALTH_DEAD_AFTER   3
+#define HEALTH_BUCKETS      64      // 4 per octave from 64 us
+
+typedef enum {
+    LINK_UNKNOWN,
+    LINK_GOOD,
+    LINK_DEGRADED,
+    LINK_DEAD
+} LinkState;
+
+typedef struct {
+    char ip[16];
+    char name[32];
+    char model[16];
+    char firmware[16];
+} MixerInfo;
+
+typedef struct {
+    LinkState state;
+    u32 p50_us;
+    u32 p99_us;
+    u32 last_us;            // Last answered probe
+    u16 probes;             // In the window
+    u16 lost;               // In the window
+    u32 histogram[HEALTH_BUCKETS];  // Window counts
+    MixerInfo mixer;        // From the last /xinfo reply
+} LinkHealth;
+
+void link_health_init(void);
+void link_health_shutdown(void);
+void link_health_reset(void);           // Address changed: forget the old link
+
+void link_health_get(LinkHealth *out);     // The mixer (target 0)
+void link_health_get_target(int target, LinkHealth *out);
+LinkState link_health_state(void);
+u32 link_health_bucket_us(int bucket);  // Upper bound of a histogram bucket
+
+// /xinfo ,ssss <ip> <name> <model> <firmware>; 1 if parsed
+int xinfo_parse(const u8 *packet, int len, MixerInfo *out);
+
+#endif
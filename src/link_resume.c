@@ -0,0 +1,160 @@
+#include <string.h>
+
+#include "log.h"
+#include "osc.h"
+#include "osc_query.h"
+#include "cue_engine.h"
+#include "link_health.h"
+#include "link_resume.h"
+
+#define RESUME_WIFI_POLL_MS     50
+#define RESUME_FLUSH_MS         1000
+
+static Thread s_thread = NULL;
+static LightEvent s_wake;
+static LightLock s_lock;            // Guards the request and the report
+static volatile int s_exit = 0;
+
+static u32 s_pending = 0;           // Bit per ResumeReason
+static ResumeReport s_report;
+static int s_report_ready = 0;
+
+static const char *s_reason_names[RESUME_NUM_REASONS] = { "wake-up", "socket error", "new address" };
+
+// ============================================================================
+// RESUME THREAD
+// ============================================================================
+
+static u32 ms_since(u64 start)
+{
+    return (u32)((svcGetSystemTick() - start) / CPU_TICKS_PER_MSEC);
+}
+
+static void resume(ResumeReason reason)
+{
+    ResumeReport report;
+    memset(&report, 0, sizeof(report));
+    report.reason = reason;
+    report.resynced_step = -1;
+
+    // Wi-Fi takes a few seconds to re-associate after the lid opens
+    u64 start = svcGetSystemTick();
+    while (!platform_network_up() && !s_exit && ms_since(start) < RESUME_WIFI_WAIT_MS) {
+        svcSleepThread((s64)RESUME_WIFI_POLL_MS * 1000000LL);
+    }
+    if (s_exit) return;
+    report.wifi_wait_ms = ms_since(start);
+
+    u64 ready_start = svcGetSystemTick();
+    if (osc_reconnect()) {
+        link_health_reset();
+
+        u8 reply[OSC_REPLY_MAX];
+        for (int i = 0; i < RESUME_PROBE_TRIES && !report.answered && !s_exit; i++) {
+            report.answered = osc_query("/xinfo", reply, sizeof(reply), RESUME_PROBE_MS) > 0;
+        }
+
+        // Put the console back on the current cue (the shadows were reset, so all of it)
+        int step = cue_last_fired();
+        if (report.answered && step >= 0 && !s_exit) {
+            cue_send_step(step, 0);
+            osc_pacer_flush(osc_pacer(), RESUME_FLUSH_MS);
+            report.resynced_step = step;
+        }
+    }
+    report.ready_ms = ms_since(ready_start);
+
+    LOG_INFO("[RESUME] After %s: Wi-Fi %lu ms, console %s, step %d resent, ready in %lu ms",
+             s_reason_names[reason], (unsigned long)report.wifi_wait_ms,
+             report.answered ? "answered" : "silent", report.resynced_step + 1,
+             (unsigned long)report.ready_ms);
+
+    LightLock_Lock(&s_lock);
+    s_report = report;
+    s_report_ready = 1;
+    LightLock_Unlock(&s_lock);
+}
+
+static void resume_thread_main(void *arg)
+{
+    (void)arg;
+    while (!s_exit) {
+        LightEvent_Wait(&s_wake);
+        if (s_exit) break;
+
+        // Everything requested so far is handled by one pass; the most
+        // specific reason is the one reported
+        LightLock_Lock(&s_lock);
+        u32 pending = s_pending;
+        s_pending = 0;
+        LightLock_Unlock(&s_lock);
+        if (!pending) continue;
+
+        ResumeReason reason = RESUME_WAKE;
+        for (int r = 0; r < RESUME_NUM_REASONS; r++) {
+            if (pending & (1u << r)) reason = (ResumeReason)r;
+        }
+        resume(reason);
+    }
+}
+
+// Main thread, from aptMainLoop()
+static void on_resume(void)
+{
+    link_resume_request(RESUME_WAKE);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void link_resume_init(void)
+{
+    LightLock_Init(&s_lock);
+    LightEvent_Init(&s_wake, RESET_ONESHOT);
+
+    // Below the main loop: waiting for Wi-Fi must never hold up a frame
+    s_exit = 0;
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    s_thread = threadCreate(resume_thread_main, NULL, 8 * 1024, prio + 1, -2, false);
+    if (!s_thread) {
+        LOG_ERROR("[RESUME] Resume thread not started");
+        return;
+    }
+    platform_on_resume(on_resume);
+}
+
+void link_resume_shutdown(void)
+{
+    if (s_thread) {
+        platform_on_resume(NULL);
+        s_exit = 1;
+        LightEvent_Signal(&s_wake);
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    }
+}
+
+void link_resume_request(ResumeReason reason)
+{
+    if (!s_thread || reason >= RESUME_NUM_REASONS) return;
+
+    LightLock_Lock(&s_lock);
+    s_pending |= 1u << reason;
+    LightLock_Unlock(&s_lock);
+    LightEvent_Signal(&s_wake);
+}
+
+int link_resume_take_report(ResumeReport *out)
+{
+    LightLock_Lock(&s_lock);
+    int ready = s_report_ready;
+    if (ready) {
+        *out = s_report;
+        s_report_ready = 0;
+    }
+    LightLock_Unlock(&s_lock);
+    return ready;
+}
@@ -0,0 +1,48 @@
+#ifndef LINK_RESUME_H
+#define LINK_RESUME_H
+
+#include "platform.h"
+
+// ============================================================================
+// LINK RESUME
+// ============================================================================
+// Closing the lid or losing Wi-Fi leaves the OSC socket dead until the app
+// restarts. A resume thread re-creates it instead, when
+//
+//   - APT reports a wake-up or a return from the HOME menu,
+//   - osc_send() gets a socket error (not just a full buffer),
+//   - the network window saves a new address.
+//
+// It waits for Wi-Fi to come back (at most RESUME_WIFI_WAIT_MS), calls
+// osc_reconnect(), restarts link health, checks that the console answers
+// /xinfo and sends the last fired step again so the console is back on the
+// current cue. Requests arriving while one runs are folded into it.
+
+#define RESUME_WIFI_WAIT_MS     15000
+#define RESUME_PROBE_MS         250
+#define RESUME_PROBE_TRIES      4
+
+typedef enum {
+    RESUME_WAKE,
+    RESUME_SOCKET_ERROR,
+    RESUME_ADDRESS,
+    RESUME_NUM_REASONS
+} ResumeReason;
+
+typedef struct {
+    ResumeReason reason;
+    int answered;           // The console answered /xinfo afterwards
+    int resynced_step;      // Step sent again, -1 if none was fired yet
+    u32 wifi_wait_ms;       // Until Wi-Fi was back
+    u32 ready_ms;           // From Wi-Fi back to resynced
+} ResumeReport;
+
+void link_resume_init(void);
+void link_resume_shutdown(void);
+
+// Any thread (cheap: just wakes the resume thread)
+void link_resume_request(ResumeReason reason);
+// Main loop: 1 and the report once a resume finished
+int link_resume_take_report(ResumeReport *out);
+
+#endif
@@ -0,0 +1,144 @@
+#include "log.h"
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <sys/stat.h>
+
+#include "mpmc_ring.h"
+
+// ============================================================================
+// RING BUFFER
+// ============================================================================
+// Any thread logs into the lock-free ring (mpmc_ring.h); only the flush
+// thread drains it.
+
+typedef struct {
+    u8 level;
+    u64 tick;
+    char text[LOG_MSG_MAX];
+} LogRecord;
+
+static LogRecord s_records[LOG_RING_SIZE];
+static u32 s_seq[LOG_RING_SIZE];
+static MpmcRing s_ring;
+static u64 s_start_tick = 0;
+static int s_ring_ready = 0;
+
+static Thread s_thread = NULL;
+static LightEvent s_wake;
+static volatile int s_exit = 0;
+static FILE *s_file = NULL;
+
+static const char *LEVEL_NAMES[] = { "ERROR", "WARN ", "INFO ", "DEBUG" };
+
+static void log_ring_init(void)
+{
+    mpmc_ring_init(&s_ring, s_seq, s_records, LOG_RING_SIZE, sizeof(LogRecord));
+    s_start_tick = svcGetSystemTick();
+    s_ring_ready = 1;
+}
+
+void log_write(int level, const char *fmt, ...)
+{
+    if (!s_ring_ready) log_ring_init();
+
+    // Ring full: dropped and counted, never block the caller
+    u32 pos;
+    LogRecord *r = (LogRecord *)mpmc_ring_claim(&s_ring, &pos);
+    if (!r) return;
+
+    r->level = (u8)level;
+    r->tick = svcGetSystemTick();
+
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(r->text, sizeof(r->text), fmt, args);
+    va_end(args);
+
+    // Wake the flusher early once the ring is half full
+    if (mpmc_ring_publish(&s_ring, pos) && s_thread) {
+        LightEvent_Signal(&s_wake);
+    }
+}
+
+unsigned int log_dropped(void)
+{
+    return s_ring_ready ? mpmc_ring_dropped(&s_ring) : 0;
+}
+
+// ============================================================================
+// FLUSH THREAD
+// ============================================================================
+
+static void log_drain(void)
+{
+    int wrote = 0;
+
+    LogRecord *r;
+    while ((r = (LogRecord *)mpmc_ring_peek(&s_ring)) != NULL) {
+        if (s_file) {
+            u32 ms = (u32)((r->tick - s_start_tick) / CPU_TICKS_PER_MSEC);
+            fprintf(s_file, "[%6lu.%03lu] %s %s\n", (unsigned long)(ms / 1000),
+                    (unsigned long)(ms % 1000), LEVEL_NAMES[r->level & 3], r->text);
+            wrote = 1;
+        }
+        mpmc_ring_release(&s_ring);
+    }
+
+    if (s_file && wrote) fflush(s_file);
+}
+
+static void log_thread_main(void *arg)
+{
+    (void)arg;
+
+    while (!s_exit) {
+        LightEvent_WaitTimeout(&s_wake, (s64)LOG_FLUSH_MS * 1000000LL);
+        log_drain();
+    }
+    log_drain();
+}
+
+void log_init(void)
+{
+    if (!s_ring_ready) log_ring_init();
+
+    mkdir(PLATFORM_DATA_DIR, 0777);
+    s_file = fopen(LOG_PATH, "w");
+    if (s_file) {
+        static char io_buf[4096];
+        setvbuf(s_file, io_buf, _IOFBF, sizeof(io_buf));
+    }
+
+    LightEvent_Init(&s_wake, RESET_ONESHOT);
+    s_exit = 0;
+
+    // Lower priority than the main thread: flushing only uses idle time
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    s_thread = threadCreate(log_thread_main, NULL, 8 * 1024, prio + 1, -2, false);
+    if (!s_thread) {
+        LOG_WARN("log: flush thread not started, writing on exit only");
+    }
+}
+
+void log_shutdown(void)
+{
+    u32 dropped = log_dropped();
+    if (dropped) LOG_WARN("log: %lu records dropped (ring full)", (unsigned long)dropped);
+
+    if (s_thread) {
+        s_exit = 1;
+        LightEvent_Signal(&s_wake);
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    } else {
+        log_drain();
+    }
+
+    if (s_file) {
+        fclose(s_file);
+        s_file = NULL;
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include "platform.h"
+
+// ============================================================================
+// ASYNC LOGGER
+// ============================================================================
+// LOG_* macros format a record into a lock-free in-memory ring; a low
+// priority background thread appends the ring to LOG_PATH. The caller never
+// touches the SD card, so logging is safe on the GO path.
+//
+// Records above LOG_LEVEL are compiled out (make LOG_LEVEL=3 for debug).
+// When the ring is full new records are dropped and counted.
+
+#define LOG_LVL_ERROR   0
+#define LOG_LVL_WARN    1
+#define LOG_LVL_INFO    2
+#define LOG_LVL_DEBUG   3
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LVL_INFO
+#endif
+
+#define LOG_PATH            PLATFORM_DATA_DIR "/x18mixer.log"
+#define LOG_RING_SIZE       256     // Records, must be a power of two
+#define LOG_MSG_MAX         120     // Bytes per record (longer text is truncated)
+#define LOG_FLUSH_MS        500     // Background flush period
+
+void log_init(void);        // Truncate LOG_PATH and start the flush thread
+void log_shutdown(void);    // Drain the ring and stop the thread
+void log_write(int level, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+unsigned int log_dropped(void);
+
+#if LOG_LEVEL >= LOG_LVL_ERROR
+#define LOG_ERROR(...) log_write(LOG_LVL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) ((void)0)
+#endif
+
+#if LOG_LEVEL >= LOG_LVL_WARN
+#define LOG_WARN(...)  log_write(LOG_LVL_WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...)  ((void)0)
+#endif
+
+#if LOG_LEVEL >= LOG_LVL_INFO
+#define LOG_INFO(...)  log_write(LOG_LVL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...)  ((void)0)
+#endif
+
+#if LOG_LEVEL >= LOG_LVL_DEBUG
+#define LOG_DEBUG(...) log_write(LOG_LVL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
+
+#endif
@@ -22,6 +22,20 @@
 #include "network_config_window.h"
 #include "eq_window.h"
 #include "options_window.h"
+#include "osc.h"
+#include "cue_engine.h"
+#include "osc_control.h"
+#include "osc_query.h"
+#include "snap_offload.h"
+#include "step_capture.h"
+#include "go_verify.h"
+#include "link_health.h"
+#include "mixer_discovery.h"
+#include "osc_targets.h"
+#include "link_resume.h"
+#include "osc_capture.h"
+#include "input.h"
+#include "platform.h"
 
 // ============================================================================
 // SOCKET BUFFER (for socInit on 3DS)
@@ -92,328 +106,26 @@ void handle_net_config_input(u32 kDown);
 void render_net_config_window(void);
 void ip_digits_to_display(const char *digits, char *display_buf, int max_len);
 
-// ============================================================================
-// OSC CORE FUNCTIONS (Phase 1 - Send Only)
-// ============================================================================
-
-// Initialize OSC connection
-void osc_init(void)
-{
-    FILE *dbg = fopen("/3ds/x18mixer/osc_debug.txt", "w");
-    if (dbg) fprintf(dbg, "[OSC_INIT] Starting OSC initialization...\n");
-    
-    // Create UDP socket
-    g_osc_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-    if (dbg) fprintf(dbg, "[OSC_INIT] socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP) returned: %d\n", g_osc_socket);
-    
-    if (g_osc_socket < 0) {
-        if (dbg) fprintf(dbg, "[OSC_INIT] ERROR: Failed to create socket\n");
-        if (dbg) fclose(dbg);
-        return;
-    }
-    
-    if (g_osc_socket < 0) {
-        if (dbg) fprintf(dbg, "[OSC_INIT] ERROR: Failed to create socket\n");
-        if (dbg) fclose(dbg);
-        return;
-    }
-    
-    // Setup mixer address
-    memset(&g_mixer_addr, 0, sizeof(g_mixer_addr));
-    g_mixer_addr.sin_family = AF_INET;
-    g_mixer_addr.sin_port = htons(g_mixer_port);
-    
-    if (dbg) fprintf(dbg, "[OSC_INIT] Parsing IP: '%s' (len=%d), Port: %d\n", g_mixer_host, (int)strlen(g_mixer_host), g_mixer_port);
-    
-    int ret = inet_pton(AF_INET, g_mixer_host, &g_mixer_addr.sin_addr);
-    if (dbg) fprintf(dbg, "[OSC_INIT] inet_pton returned: %d\n", ret);
-    
-    if (ret <= 0) {
-        if (dbg) fprintf(dbg, "[OSC_INIT] ERROR: Invalid IP address: '%s' (ret=%d)\n", g_mixer_host, ret);
-        if (dbg) fclose(dbg);
-        close(g_osc_socket);
-        g_osc_socket = -1;
-        return;
-    }
-    
-    g_osc_connected = 1;
-    if (dbg) fprintf(dbg, "[OSC_INIT] SUCCESS! Connected to %s:%d, socket=%d\n", g_mixer_host, g_mixer_port, g_osc_socket);
-    if (dbg) fclose(dbg);
-}
-
-// Send OSC message (generic)
-int osc_send(const uint8_t *packet, int packet_size)
-{
-    if (g_osc_socket < 0 || !g_osc_connected) {
-        return -1;
-    }
-    
-    int n = sendto(g_osc_socket, packet, packet_size, 0, 
-                   (struct sockaddr*)&g_mixer_addr, sizeof(g_mixer_addr));
-    
-    return n;
-}
-
-// Send fader value for a channel
-void osc_send_fader(int channel, float value)
-{
-    // Validate channel
-    if (channel < 0 || channel >= 16) return;
-    
-    // Build OSC message: /ch/XX/mix/fader ,f <value>
-    // Format: address(null-padded) + ",f\0\0" + float(4 bytes)
-    
-    uint8_t packet[32];
-    int pos = 0;
-    
-    // Address: /ch/XX/mix/fader
-    pos += snprintf((char*)&packet[pos], 30, "/ch/%02d/mix/fader", channel + 1);
-    pos++;  // null terminator
-    
-    // Pad to 4-byte boundary
-    while (pos % 4 != 0) {
-        packet[pos++] = 0;
-    }
-    
-    // Type tag: ,f
-    packet[pos++] = ',';
-    packet[pos++] = 'f';
-    packet[pos++] = 0;
-    packet[pos++] = 0;
-    
-    // Float value (big-endian)
-    uint32_t float_bits;
-    memcpy(&float_bits, &value, sizeof(float_bits));
-    packet[pos++] = (float_bits >> 24) & 0xFF;
-    packet[pos++] = (float_bits >> 16) & 0xFF;
-    packet[pos++] = (float_bits >> 8) & 0xFF;
-    packet[pos++] = float_bits & 0xFF;
-    
-    int result = osc_send(packet, pos);
-    printf("[DEBUG] OSC_SEND_FADER CH%02d: value=%.2f, result=%d, connected=%d, socket=%d\n", 
-           channel + 1, value, result, g_osc_connected, g_osc_socket);
-}
-
-// Send mute state for a channel
-void osc_send_mute(int channel, int muted)
-{
-    // Validate channel
-    if (channel < 0 || channel >= 16) return;
-    
-    // Build OSC message: /ch/XX/mix/on ,i <value>
-    // Syntax: 0=muted, 1=unmuted
-    
-    uint8_t packet[32];
-    int pos = 0;
-    
-    // Address: /ch/XX/mix/on
-    pos += snprintf((char*)&packet[pos], 30, "/ch/%02d/mix/on", channel + 1);
-    pos++;  // null terminator
-    
-    // Pad to 4-byte boundary
-    while (pos % 4 != 0) {
-        packet[pos++] = 0;
-    }
-    
-    // Type tag: ,i
-    packet[pos++] = ',';
-    packet[pos++] = 'i';
-    packet[pos++] = 0;
-    packet[pos++] = 0;
-    
-    // Int value (big-endian): 0=muted, 1=unmuted
-    int on = muted ? 0 : 1;
-    uint32_t int_val = on;
-    packet[pos++] = (int_val >> 24) & 0xFF;
-    packet[pos++] = (int_val >> 16) & 0xFF;
-    packet[pos++] = (int_val >> 8) & 0xFF;
-    packet[pos++] = int_val & 0xFF;
-    
-    osc_send(packet, pos);
-    
-    if (g_osc_verbose) {
-        printf("[OSC] CH%02d mute: %s\n", channel + 1, muted ? "ON" : "OFF");
-    }
-}
-
-// Send EQ parameter for a channel
-void osc_send_eq_param(int channel, int band, const char *param, float value)
-{
-    // Validate inputs
-    if (channel < 0 || channel >= 16) return;
-    if (band < 0 || band >= 5) return;
-    
-    // Build OSC message: /ch/XX/eq/B/param ,f <value>
-    // param: "type" (int), "f" (float), "g" (float), "q" (float)
-    
-    uint8_t packet[40];
-    int pos = 0;
-    int is_int = (strcmp(param, "type") == 0);
-    
-    // Address: /ch/XX/eq/B/param
-    pos += snprintf((char*)&packet[pos], 38, "/ch/%02d/eq/%d/%s", channel + 1, band + 1, param);
-    pos++;  // null terminator
-    
-    // Pad to 4-byte boundary
-    while (pos % 4 != 0) {
-        packet[pos++] = 0;
-    }
-    
-    // Type tag: ,i or ,f
-    packet[pos++] = ',';
-    packet[pos++] = is_int ? 'i' : 'f';
-    packet[pos++] = 0;
-    packet[pos++] = 0;
-    
-    // Value (big-endian)
-    if (is_int) {
-        uint32_t int_val = (uint32_t)value;
-        packet[pos++] = (int_val >> 24) & 0xFF;
-        packet[pos++] = (int_val >> 16) & 0xFF;
-        packet[pos++] = (int_val >> 8) & 0xFF;
-        packet[pos++] = int_val & 0xFF;
-    } else {
-        uint32_t float_bits;
-        memcpy(&float_bits, &value, sizeof(float_bits));
-        packet[pos++] = (float_bits >> 24) & 0xFF;
-        packet[pos++] = (float_bits >> 16) & 0xFF;
-        packet[pos++] = (float_bits >> 8) & 0xFF;
-        packet[pos++] = float_bits & 0xFF;
-    }
-    
-    osc_send(packet, pos);
-    
-    if (g_osc_verbose) {
-        printf("[OSC] CH%02d EQ%d %s: %.2f\n", channel + 1, band + 1, param, value);
-    }
-}
-
-// Shutdown OSC (called on app exit)
-void osc_shutdown(void)
-{
-    if (g_osc_socket >= 0) {
-        close(g_osc_socket);
-        g_osc_socket = -1;
-        g_osc_connected = 0;
-        if (g_osc_verbose) printf("[OSC] Connection closed\n");
-    }
-}
-
-// Send complete step data via OSC (all 16 faders + 16 mutes + all EQ data)
-void send_step_osc(int step_idx)
-{
-    FILE *dbg = fopen("/3ds/x18mixer/osc_debug.txt", "a");
-    if (dbg) fprintf(dbg, "[SEND_STEP] step_idx=%d, connected=%d, socket=%d, send_fader=%d, send_eq=%d\n", 
-                     step_idx, g_osc_connected, g_osc_socket, g_options.send_fader, g_options.send_eq);
-    
-    if (step_idx < 0 || step_idx >= g_current_show.num_steps) {
-        if (dbg) fprintf(dbg, "[SEND_STEP] Invalid step index\n");
-        if (dbg) fclose(dbg);
-        return;
-    }
-    if (!g_osc_connected) {
-        if (dbg) fprintf(dbg, "[SEND_STEP] OSC not connected, returning\n");
-        if (dbg) fclose(dbg);
-        return;
-    }
-    
-    Step *step = &g_current_show.steps[step_idx];
-    
-    if (g_osc_verbose) {
-        printf("[OSC] === Sending Step %d ===\n", step_idx + 1);
-    }
-    
-    // Send all 16 faders (if enabled)
-    if (g_options.send_fader) {
-        for (int ch = 0; ch < 16; ch++) {
-            osc_send_fader(ch, step->volumes[ch]);
-        }
-    }
-    
-    // Send all 16 mutes (ALWAYS sent, regardless of options)
-    for (int ch = 0; ch < 16; ch++) {
-        osc_send_mute(ch, step->mutes[ch]);
-    }
-    
-    // Send all EQ data (5 bands per channel) - if enabled AND channel EQ is enabled
-    if (g_options.send_eq) {
-        for (int ch = 0; ch < 16; ch++) {
-            ChannelEQ *eq = &step->eqs[ch];
-            // Only send EQ data if this channel's EQ is enabled
-            if (eq->enabled) {
-                for (int band = 0; band < 5; band++) {
-                    EQBand *eq_band = &eq->bands[band];
-                    // Send EQ band type, frequency, gain, Q factor
-                    osc_send_eq_param(ch, band, "type", (float)eq_band->type);
-                    osc_send_eq_param(ch, band, "f", eq_band->frequency);
-                    osc_send_eq_param(ch, band, "g", eq_band->gain);
-                    osc_send_eq_param(ch, band, "q", eq_band->q_factor);
-                }
-            }
-        }
-    }
-    
-    if (g_osc_verbose) {
-        printf("[OSC] Step %d complete (16 faders + 16 mutes + 80 EQ params)\n", step_idx + 1);
-    }
-    
-    if (dbg) {
-        fprintf(dbg, "[SEND_STEP] Step %d sent successfully\n", step_idx);
-        fclose(dbg);
-    }
-}
-
 // ============================================================================
 // SHOW/PRESET FUNCTIONS
 // ============================================================================
 
 
-// Initialize EQ with default values
-void init_channel_eq(ChannelEQ *eq)
-{
-    eq->enabled = 0;  // EQ disabled by default
-    
-    // Band 0: 64Hz Low Cut
-    eq->bands[0].frequency = 64.0f;
-    eq->bands[0].gain = 0.0f;
-    eq->bands[0].q_factor = 0.5f;
-    eq->bands[0].type = EQ_LCUT;
-    
-    // Band 1: 200Hz Peaking EQ
-    eq->bands[1].frequency = 200.0f;
-    eq->bands[1].gain = 0.0f;
-    eq->bands[1].q_factor = 5.0f;
-    eq->bands[1].type = EQ_PEQ;
-    
-    // Band 2: 500Hz Peaking EQ
-    eq->bands[2].frequency = 500.0f;
-    eq->bands[2].gain = 0.0f;
-    eq->bands[2].q_factor = 5.0f;
-    eq->bands[2].type = EQ_PEQ;
-    
-    // Band 3: 1200Hz Peaking EQ
-    eq->bands[3].frequency = 1200.0f;
-    eq->bands[3].gain = 0.0f;
-    eq->bands[3].q_factor = 5.0f;
-    eq->bands[3].type = EQ_PEQ;
-    
-    // Band 4: 4500Hz High Shelf
-    eq->bands[4].frequency = 4500.0f;
-    eq->bands[4].gain = 0.0f;
-    eq->bands[4].q_factor = 0.5f;
-    eq->bands[4].type = EQ_HSHV;
-}
-
 void init_default_show(void)
 {
+    // The control port and cue thread are already up: a remote GO may be
+    // walking the show while it is replaced
+    cue_lock_show();
+    
     // CRITICAL: Initialize entire Show structure to zero FIRST
-    memset(&g_current_show, 0, sizeof(Show));
+    show_clear(&g_current_show);
     
     // Magic number for validation
-    g_current_show.magic = 0x58334D32;  // "X34M" in hex - version identifier
+    g_current_show.magic = SHOW_MAGIC;  // "X34M" in hex - version identifier
+    cue_unlock_show();
     
     // Try to load last saved show from persistence
-    FILE *f = fopen("/3ds/x18mixer/last_show.txt", "r");
+    FILE *f = fopen(PLATFORM_DATA_DIR "/last_show.txt", "r");
     if (f) {
         char last_show[64] = "";
         if (fgets(last_show, sizeof(last_show), f)) {
@@ -434,6 +146,7 @@ void init_default_show(void)
     }
     
     // If no saved show found, create default
+    cue_lock_show();
     strcpy(g_current_show.name, "Default Show");
     g_current_show.num_steps = 3;
     
@@ -448,16 +161,21 @@ void init_default_show(void)
     }
     g_show_loaded = 1;
     g_show_modified = 0;  // Default show is not modified
+    cue_unlock_show();
 }
 
 void init_new_show(const char *name)
 {
+    cue_lock_show();
+    cue_follow_cancel();
+    step_capture_cancel();
+    
     // Initialize a brand new show with default 3 steps
     // CRITICAL: Initialize entire Show structure to zero FIRST
-    memset(&g_current_show, 0, sizeof(Show));
+    show_clear(&g_current_show);
     
     // Magic number for validation
-    g_current_show.magic = 0x58334D32;
+    g_current_show.magic = SHOW_MAGIC;
     
     strcpy(g_current_show.name, name);
     g_current_show.num_steps = 3;
@@ -474,6 +192,7 @@ void init_new_show(const char *name)
     g_show_loaded = 1;
     g_show_modified = 1;  // New show is modified (not yet saved)
     g_selected_step = 0;
+    cue_unlock_show();
 }
 
 void apply_step_to_faders(int step_idx)
@@ -489,6 +208,7 @@ void apply_step_to_faders(int step_idx)
         g_faders[i].eq_enabled = step->eqs[i].enabled;  // Get enabled flag from ChannelEQ
     }
     g_selected_step = step_idx;
+    cue_set_standby(step_idx);
 }
 
 void save_step_from_faders(int step_idx)
@@ -518,6 +238,13 @@ void add_step(void)
     
     // Create new step with default values
     snprintf(new_step->name, sizeof(new_step->name), "Step %d", new_idx + 1);
+    param_list_free(&new_step->params);
+    new_step->released_channels = 0;
+    new_step->released_groups = 0;
+    new_step->fade_tenths = 0;
+    memset(new_step->channel_fade_tenths, 0, sizeof(new_step->channel_fade_tenths));
+    new_step->follow_mode = STEP_FOLLOW_NONE;
+    new_step->follow_ms = 0;
     
     for (int i = 0; i < 16; i++) {
         new_step->volumes[i] = 0.5f;
@@ -554,8 +281,17 @@ void duplicate_step(void)
     int new_idx = g_current_show.num_steps;
     Step *new_step = &g_current_show.steps[new_idx];
     
-    // Copy the step
-    memcpy(new_step, src_step, sizeof(Step));
+    // Copy the step (the parameter list needs its own storage)
+    memcpy(new_step, src_step, STEP_CORE_SIZE);
+    if (!param_list_copy(&new_step->params, &src_step->params)) {
+        LOG_WARN("[STEP] Out of memory copying %d params", src_step->params.count);
+    }
+    new_step->released_channels = src_step->released_channels;
+    new_step->released_groups = src_step->released_groups;
+    new_step->fade_tenths = src_step->fade_tenths;
+    memcpy(new_step->channel_fade_tenths, src_step->channel_fade_tenths, sizeof(new_step->channel_fade_tenths));
+    new_step->follow_mode = src_step->follow_mode;
+    new_step->follow_ms = src_step->follow_ms;
     
     // Build name safely using temp buffer
     char temp_name[64];
@@ -633,8 +369,8 @@ void save_show_to_file(Show *show)
     create_shows_directory();
     
     // Ensure magic number is set BEFORE saving
-    if (show->magic != 0x58334D32) {
-        show->magic = 0x58334D32;
+    if (show->magic != SHOW_MAGIC) {
+        show->magic = SHOW_MAGIC;
     }
     
     // Sanitize the show name for use as a filename
@@ -644,21 +380,10 @@ void save_show_to_file(Show *show)
     char filepath[256];
     snprintf(filepath, sizeof(filepath), "%s%s.x18s", SHOWS_DIR, safe_name);
     
-    // Try to open file for writing
-    FILE *f = fopen(filepath, "wb");
-    if (!f) {
-        snprintf(g_save_status, sizeof(g_save_status), "ERROR: Cannot save file");
-        g_save_status_timer = 120;  // Show for 2 seconds
-        return;
-    }
-    
-    // Write the show struct
-    size_t written = fwrite(show, sizeof(Show), 1, f);
+    TRACE_BEGIN("save_show");
     
-    // Ensure data is written
-    fflush(f);
-    fsync(fileno(f));
-    fclose(f);
+    // Write the show (only the steps in use, and only their stored params)
+    int written = show_write_file(filepath, show);
     
     // Report status
     if (written == 1) {
@@ -666,7 +391,7 @@ void save_show_to_file(Show *show)
         g_save_status_timer = 120;  // Show for 2 seconds
         
         // Update last show persistence file
-        FILE *pf = fopen("/3ds/x18mixer/last_show.txt", "w");
+        FILE *pf = fopen(PLATFORM_DATA_DIR "/last_show.txt", "w");
         if (pf) {
             fprintf(pf, "%s", safe_name);
             fflush(pf);
@@ -679,6 +404,7 @@ void save_show_to_file(Show *show)
         snprintf(g_save_status, sizeof(g_save_status), "ERROR: Write failed for %s", safe_name);
         g_save_status_timer = 120;
     }
+    TRACE_END("save_show");
 }
 
 // Save only the EQ for a specific channel in the current step
@@ -697,148 +423,25 @@ void save_channel_eq_only(int channel)
     g_save_status_timer = 120;
 }
 
-// Old format structures (for backward compatibility)
-typedef struct {
-    char name[32];
-    float volumes[16];
-    int mutes[16];
-    int eqs_old[16];  // OLD: was just an int flag
-} __attribute__((packed)) OldStep;
-
-typedef struct {
-    char name[64];
-    OldStep steps_old[200];
-    int num_steps;
-} __attribute__((packed)) OldShow;
-
-// Convert old show format to new format
-void migrate_old_show_to_new(OldShow *old, Show *new_show)
-{
-    // CRITICAL: Initialize entire structure to zero first
-    memset(new_show, 0, sizeof(Show));
-    
-    strcpy(new_show->name, old->name);
-    new_show->num_steps = old->num_steps;
-    if (new_show->num_steps > 200) new_show->num_steps = 200;  // Sanity check
-    if (new_show->num_steps < 1) new_show->num_steps = 1;      // At least 1 step
-    
-    for (int s = 0; s < new_show->num_steps; s++) {
-        strcpy(new_show->steps[s].name, old->steps_old[s].name);
-        
-        for (int i = 0; i < 16; i++) {
-            new_show->steps[s].volumes[i] = old->steps_old[s].volumes[i];
-            new_show->steps[s].mutes[i] = old->steps_old[s].mutes[i];
-            
-            // Initialize new EQ structure
-            init_channel_eq(&new_show->steps[s].eqs[i]);
-            // Set enabled flag from old format
-            new_show->steps[s].eqs[i].enabled = old->steps_old[s].eqs_old[i];
-        }
-    }
-}
-
 int load_show_from_file(const char *filename, Show *out_show)
 {
-    if (!filename || !out_show) return 0;
-    
-    create_shows_directory();
-    
-    // CRITICAL: Initialize entire Show structure to zero BEFORE loading
-    memset(out_show, 0, sizeof(Show));
-    
-    char filepath[256];
-    snprintf(filepath, sizeof(filepath), "%s%s.x18s", SHOWS_DIR, filename);
-    
-    FILE *f = fopen(filepath, "rb");
-    if (!f) return 0;
-    
-    // Get file size to detect format version
-    fseek(f, 0, SEEK_END);
-    long file_size = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    
-    // Calculate expected size
-    long expected_new_size = sizeof(Show);
-    
-    // Old format size: ~44868 bytes (64 + 200*224 + 4)
-    // New format size: ~300868 bytes (64 + 200*1504 + 4)
-    
-    // Check if this looks like old format by file size
-    if (file_size < 100000) {  // Conservatively assume < 100KB is old format
-        // Allocate old show on HEAP to avoid stack overflow
-        OldShow *old_show = (OldShow*)malloc(sizeof(OldShow));
-        if (!old_show) {
-            fclose(f);
-            return 0;
-        }
-        
-        memset(old_show, 0, sizeof(OldShow));
-        size_t read = fread(old_show, sizeof(OldShow), 1, f);
-        fclose(f);
-        
-        if (read == 1 && old_show->num_steps > 0 && old_show->num_steps <= 200) {
-            // Successfully loaded as old format, migrate to new
-            migrate_old_show_to_new(old_show, out_show);
-            free(old_show);
-            return 1;
-        }
-        // If migration failed, keep the zero-initialized structure
-        free(old_show);
-        return 0;
-    }
-    
-    // Load as new format - but first verify file size matches expected
-    if (file_size != expected_new_size) {
-        // File size mismatch - likely corrupted or compiled with different struct sizes
-        fclose(f);
-        return 0;
-    }
-    
-    size_t read = fread(out_show, sizeof(Show), 1, f);
-    fclose(f);
-    
-    // Verify loaded data is sane
-    if (read != 1) return 0;
-    
-    // Comprehensive validation of loaded data
-    if (out_show->num_steps < 1 || out_show->num_steps > 200) {
-        // Invalid step count
-        memset(out_show, 0, sizeof(Show));
-        return 0;
-    }
-    
-    // Check magic number - but be tolerant of old files (magic == 0)
-    // Only fail if magic is non-zero AND not our expected value
-    if (out_show->magic != 0 && out_show->magic != 0x58334D32) {
-        // File header is corrupted
-        memset(out_show, 0, sizeof(Show));
-        return 0;
-    }
-    
-    // If magic is 0, set it now (was an old file)
-    if (out_show->magic == 0) {
-        out_show->magic = 0x58334D32;
-    }
-    
-    // Additional sanity checks on first step
-    Step *first_step = &out_show->steps[0];
-    
-    // Check that volumes are in valid range
-    for (int i = 0; i < 16; i++) {
-        if (first_step->volumes[i] < 0.0f || first_step->volumes[i] > 1.0f) {
-            // Volume out of range - data corrupted
-            memset(out_show, 0, sizeof(Show));
-            return 0;
-        }
-        // Check that mutes are 0 or 1
-        if (first_step->mutes[i] != 0 && first_step->mutes[i] != 1) {
-            // Invalid mute value
-            memset(out_show, 0, sizeof(Show));
-            return 0;
-        }
-    }
-    
-    return 1;
+    TRACE_BEGIN("load_show");
+    // A step may be firing from the cue thread while the current show is replaced
+    cue_lock_show();
+    if (out_show == &g_current_show) {
+        cue_follow_cancel();
+        step_capture_cancel();
+    }
+    int ok = 0;
+    if (filename) {
+        create_shows_directory();
+        char filepath[256];
+        snprintf(filepath, sizeof(filepath), "%s%s.x18s", SHOWS_DIR, filename);
+        ok = show_read_file(filepath, out_show);
+    }
+    cue_unlock_show();
+    TRACE_END("load_show");
+    return ok;
 }
 
 void list_available_shows(void)
@@ -846,8 +449,12 @@ void list_available_shows(void)
     g_num_available_shows = 0;
     create_shows_directory();
     
+    TRACE_BEGIN("list_shows");
     DIR *dir = opendir(SHOWS_DIR);
-    if (!dir) return;
+    if (!dir) {
+        TRACE_END("list_shows");
+        return;
+    }
     
     struct dirent *entry;
     while ((entry = readdir(dir)) && g_num_available_shows < MAX_SHOWS) {
@@ -866,36 +473,30 @@ void list_available_shows(void)
         }
     }
     closedir(dir);
+    TRACE_END("list_shows");
 }
 
 // Load network configuration from file
 void load_network_config(void)
 {
-    FILE *dbg = fopen("/3ds/x18mixer/osc_debug.txt", "a");
-    if (dbg) fprintf(dbg, "[LOAD_CONFIG] Loading network config...\n");
-    
-    FILE *f = fopen("/3ds/x18mixer/net.txt", "r");
+    FILE *f = fopen(PLATFORM_DATA_DIR "/net.txt", "r");
     if (!f) {
         // Use defaults if file doesn't exist
-        if (dbg) fprintf(dbg, "[LOAD_CONFIG] File not found, using empty fields\n");
         strcpy(g_mixer_host, "10.10.99.112");
         g_mixer_port = 10023;
         g_net_ip_input[0] = '\0';
         g_net_port_input[0] = '\0';
-        if (dbg) fprintf(dbg, "[LOAD_CONFIG] Defaults: host='%s', port=%d\n", g_mixer_host, g_mixer_port);
-        if (dbg) fclose(dbg);
+        LOG_INFO("[LOAD_CONFIG] net.txt not found, defaults: host='%s', port=%d", g_mixer_host, g_mixer_port);
         return;
     }
     
-    if (dbg) fprintf(dbg, "[LOAD_CONFIG] File found, reading...\n");
-    
     // Read IP (first line)
     if (fgets(g_net_ip_input, sizeof(g_net_ip_input), f)) {
         size_t len = strlen(g_net_ip_input);
         if (len > 0 && g_net_ip_input[len - 1] == '\n') {
             g_net_ip_input[len - 1] = '\0';
         }
-        if (dbg) fprintf(dbg, "[LOAD_CONFIG] Read IP: '%s'\n", g_net_ip_input);
+        LOG_DEBUG("[LOAD_CONFIG] Read IP: '%s'", g_net_ip_input);
     } else {
         g_net_ip_input[0] = '\0';
     }
@@ -906,7 +507,7 @@ void load_network_config(void)
         if (len > 0 && g_net_port_input[len - 1] == '\n') {
             g_net_port_input[len - 1] = '\0';
         }
-        if (dbg) fprintf(dbg, "[LOAD_CONFIG] Read Port: '%s'\n", g_net_port_input);
+        LOG_DEBUG("[LOAD_CONFIG] Read Port: '%s'", g_net_port_input);
     } else {
         g_net_port_input[0] = '\0';
     }
@@ -918,7 +519,6 @@ void load_network_config(void)
         int valid = inet_pton(AF_INET, g_net_ip_input, &temp);
         if (valid > 0) {
             strcpy(g_mixer_host, g_net_ip_input);
-            if (dbg) fprintf(dbg, "[LOAD_CONFIG] Updated g_mixer_host to: %s\n", g_mixer_host);
         }
     }
     
@@ -926,12 +526,11 @@ void load_network_config(void)
         int port = atoi(g_net_port_input);
         if (port > 0 && port <= 65535) {
             g_mixer_port = port;
-            if (dbg) fprintf(dbg, "[LOAD_CONFIG] Updated g_mixer_port to: %d\n", g_mixer_port);
         }
     }
     
     fclose(f);
-    if (dbg) fclose(dbg);
+    LOG_INFO("[LOAD_CONFIG] host='%s', port=%d", g_mixer_host, g_mixer_port);
 }
 
 // Save network configuration to file
@@ -939,7 +538,7 @@ void save_network_config(void)
 {
     create_shows_directory();
     
-    FILE *f = fopen("/3ds/x18mixer/net.txt", "w");
+    FILE *f = fopen(PLATFORM_DATA_DIR "/net.txt", "w");
     if (!f) {
         snprintf(g_save_status, sizeof(g_save_status), "ERROR: Cannot save net.txt");
         g_save_status_timer = 120;
@@ -976,6 +575,9 @@ void save_network_config(void)
     
     snprintf(g_save_status, sizeof(g_save_status), "Network config saved: %s:%d", g_mixer_host, g_mixer_port);
     g_save_status_timer = 120;
+    
+    // Send to the new address right away
+    link_resume_request(RESUME_ADDRESS);
 }
 
 void delete_show_file(const char *filename)
@@ -993,7 +595,7 @@ void duplicate_show_file(const char *src, const char *dst)
     if (!src || !dst) return;
     
     // Allocate on HEAP to avoid stack overflow (~300KB struct)
-    Show *temp_show = (Show *)malloc(sizeof(Show));
+    Show *temp_show = (Show *)calloc(1, sizeof(Show));
     if (!temp_show) return;
     
     if (!load_show_from_file(src, temp_show)) {
@@ -1004,6 +606,7 @@ void duplicate_show_file(const char *src, const char *dst)
     strncpy(temp_show->name, dst, sizeof(temp_show->name) - 1);
     temp_show->name[sizeof(temp_show->name) - 1] = '\0';
     save_show_to_file(temp_show);
+    show_clear(temp_show);
     free(temp_show);
     list_available_shows();
 }
@@ -1013,7 +616,7 @@ void rename_show_file(const char *old_name, const char *new_name)
     if (!old_name || !new_name) return;
     
     // Allocate on HEAP to avoid stack overflow (~300KB struct)
-    Show *temp_show = (Show *)malloc(sizeof(Show));
+    Show *temp_show = (Show *)calloc(1, sizeof(Show));
     if (!temp_show) return;
     
     if (!load_show_from_file(old_name, temp_show)) {
@@ -1025,6 +628,7 @@ void rename_show_file(const char *old_name, const char *new_name)
     strncpy(temp_show->name, new_name, sizeof(temp_show->name) - 1);
     temp_show->name[sizeof(temp_show->name) - 1] = '\0';
     save_show_to_file(temp_show);
+    show_clear(temp_show);
     free(temp_show);
     list_available_shows();
 }
@@ -1035,6 +639,8 @@ void rename_show_file(const char *old_name, const char *new_name)
 
 void init_mixer(void)
 {
+    fader_taper_init();
+    
     for (int i = 0; i < NUM_FADERS; i++) {
         g_faders[i].id = i + 1;
         g_faders[i].value = 0.5f;
@@ -1085,6 +691,138 @@ int touch_hits_eq_button(touchPosition touch, Fader *fader)
 // Forward declarations for touch handlers
 void update_eq_touch(void);
 
+// ============================================================================
+// GO
+// ============================================================================
+
+#define DEAD_GO_CONFIRM_MS 2000
+
+// A: fire the step, unless the console has stopped answering. Then the
+// first press only warns and a second one within DEAD_GO_CONFIRM_MS fires.
+static void go_with_link_check(void)
+{
+    static u64 s_armed_tick = 0;
+    u64 now = svcGetSystemTick();
+
+    if (link_health_state() == LINK_DEAD &&
+        (s_armed_tick == 0 || now - s_armed_tick > (u64)(DEAD_GO_CONFIRM_MS * CPU_TICKS_PER_MSEC))) {
+        s_armed_tick = now;
+        snprintf(g_save_status, sizeof(g_save_status), "ERROR: no answer from %s - A again to GO",
+                 g_mixer_host);
+        g_save_status_timer = 120;
+        return;
+    }
+    s_armed_tick = 0;
+
+    prof_begin(PROF_SEND_STEP);
+    cue_go(g_selected_step);
+    prof_end(PROF_SEND_STEP);
+}
+
+// ============================================================================
+// RECALL SCOPE EDITING (B held)
+// ============================================================================
+
+static void report_step_scope(void)
+{
+    const Step *step = &g_current_show.steps[g_selected_step];
+    u8 groups = ~step->released_groups;
+    snprintf(g_save_status, sizeof(g_save_status), "Step %d scope: %s %s %s %s",
+             g_selected_step + 1,
+             (groups & STEP_SCOPE_FADER) ? "FDR" : "---",
+             (groups & STEP_SCOPE_MUTE) ? "MUTE" : "----",
+             (groups & STEP_SCOPE_EQ) ? "EQ" : "--",
+             (groups & STEP_SCOPE_PARAMS) ? "PRM" : "---");
+    g_save_status_timer = 120;
+}
+
+static void report_step_follow(const Step *step)
+{
+    static const char *modes[STEP_FOLLOW_MODES] = { "manual", "after prev", "at show time" };
+    snprintf(g_save_status, sizeof(g_save_status), "Step %d: %s %lu.%lu s", g_selected_step + 1,
+             modes[step->follow_mode % STEP_FOLLOW_MODES],
+             (unsigned long)(step->follow_ms / 1000), (unsigned long)(step->follow_ms % 1000 / 100));
+    g_save_status_timer = 120;
+}
+
+// B + X/Y/L/R: toggle the fader/mute/EQ/params groups of the current step
+// B + Left/Right: step fade time -/+ 0.5 s
+// B + A: cycle the step's follow mode, B + Up/Down: follow time +/- 0.5 s
+// B + SELECT: cancel a pending auto-follow
+void handle_scope_input(u32 kDown)
+{
+    if (g_selected_step < 0 || g_selected_step >= g_current_show.num_steps) return;
+    
+    static const u32 keys[4] = { KEY_X, KEY_Y, KEY_L, KEY_R };
+    static const u8 group_bits[4] = { STEP_SCOPE_FADER, STEP_SCOPE_MUTE, STEP_SCOPE_EQ, STEP_SCOPE_PARAMS };
+    
+    Step *step = &g_current_show.steps[g_selected_step];
+    for (int i = 0; i < 4; i++) {
+        if (kDown & keys[i]) {
+            step->released_groups ^= group_bits[i];
+            g_show_modified = 1;
+            report_step_scope();
+        }
+    }
+    
+    if (kDown & (KEY_DLEFT | KEY_DRIGHT)) {
+        int tenths = step->fade_tenths + ((kDown & KEY_DRIGHT) ? 5 : -5);
+        if (tenths < 0) tenths = 0;
+        if (tenths > 6000) tenths = 6000;   // 10 minutes
+        step->fade_tenths = (u16)tenths;
+        g_show_modified = 1;
+        snprintf(g_save_status, sizeof(g_save_status), "Step %d fade: %d.%d s",
+                 g_selected_step + 1, tenths / 10, tenths % 10);
+        g_save_status_timer = 120;
+    }
+    
+    if (kDown & KEY_A) {
+        step->follow_mode = (step->follow_mode + 1) % STEP_FOLLOW_MODES;
+        g_show_modified = 1;
+        report_step_follow(step);
+    }
+    
+    if (kDown & (KEY_DUP | KEY_DDOWN)) {
+        s64 ms = (s64)step->follow_ms + ((kDown & KEY_DUP) ? 500 : -500);
+        if (ms < 0) ms = 0;
+        if (ms > 24 * 3600 * 1000) ms = 24 * 3600 * 1000;
+        step->follow_ms = (u32)ms;
+        g_show_modified = 1;
+        report_step_follow(step);
+    }
+    
+    if (kDown & KEY_SELECT) {
+        cue_follow_cancel();
+        snprintf(g_save_status, sizeof(g_save_status), "Auto-follow stopped");
+        g_save_status_timer = 120;
+    }
+}
+
+// B + tap: mute button toggles the channel's show-wide safe, EQ button
+// toggles whether the current step recalls the channel
+static void handle_scope_touch(void)
+{
+    for (int i = 0; i < NUM_FADERS; i++) {
+        if (touch_hits_mute_button(g_touchPos, &g_faders[i])) {
+            g_current_show.channel_safes ^= (1 << i);
+            g_show_modified = 1;
+            snprintf(g_save_status, sizeof(g_save_status), "CH %02d %s", i + 1,
+                     (g_current_show.channel_safes & (1 << i)) ? "SAFE" : "not safe");
+            g_save_status_timer = 120;
+            return;
+        }
+        if (touch_hits_eq_button(g_touchPos, &g_faders[i])) {
+            Step *step = &g_current_show.steps[g_selected_step];
+            step->released_channels ^= (1 << i);
+            g_show_modified = 1;
+            snprintf(g_save_status, sizeof(g_save_status), "Step %d %s CH %02d", g_selected_step + 1,
+                     (step->released_channels & (1 << i)) ? "releases" : "recalls", i + 1);
+            g_save_status_timer = 120;
+            return;
+        }
+    }
+}
+
 void update_mixer_touch(void)
 {
     int touch_edge = g_isTouched && !g_wasTouched;
@@ -1106,6 +844,12 @@ void update_mixer_touch(void)
         return;
     }
     
+    // Holding B edits the recall scope instead of the faders
+    if (input_keys_held() & KEY_B) {
+        if (touch_edge) handle_scope_touch();
+        return;
+    }
+    
     // On new touch, find which fader is being touched
     if (touch_edge) {
         g_touched_fader_index = -1;  // Reset
@@ -1151,9 +895,9 @@ void update_mixer_touch(void)
 
 void update_touch_input(void)
 {
-    hidTouchRead(&g_touchPos);
+    input_touch(&g_touchPos.px, &g_touchPos.py);
     g_wasTouched = g_isTouched;
-    g_isTouched = (hidKeysHeld() & KEY_TOUCH) ? 1 : 0;
+    g_isTouched = (input_keys_held() & KEY_TOUCH) ? 1 : 0;
     update_mixer_touch();
 }
 
@@ -1175,24 +919,63 @@ void init_graphics(void)
     // The .3dsx launcher does this automatically, but CIA needs it explicitly
     fsInit();
     
+    // Background log writer (needs the SD card)
+    log_init();
+    
     // Initialize socket services on 3DS BEFORE using sockets
     int soc_ret = socInit(SOC_BUFFER, sizeof(SOC_BUFFER));
-    FILE *dbg_soc = fopen("/3ds/x18mixer/osc_debug.txt", "w");
-    if (dbg_soc) {
-        fprintf(dbg_soc, "[INIT] socInit() returned: %d\n", soc_ret);
-        fclose(dbg_soc);
+    if (soc_ret < 0) {
+        LOG_ERROR("[INIT] socInit() failed: 0x%08lX", (unsigned long)soc_ret);
     }
     
+    // Wi-Fi status and sleep/resume hooks (platform.h)
+    platform_init();
+    
+    // Mixer address first: osc_init() connects to it
+    load_network_config();
+    
     // Initialize OSC (Phase 1)
     osc_init();
     
-    // Load network configuration
-    load_network_config();
+    // Console replies to queries
+    osc_query_init();
+    
+    // /xinfo probes: RTT and loss of the link to the console
+    link_health_init();
+    
+    // New socket and cue resync after sleep, Wi-Fi loss or an address change
+    link_resume_init();
+    
+    // Fade timer thread (sends through OSC)
+    cue_engine_init();
+    
+    // Read-back of each GO (when enabled)
+    go_verify_init();
+    
+    prof_init();
     
     // Load OSC send options
     init_options();
     load_options();
     
+    // Session recording of every OSC packet (when enabled)
+    if (g_options.capture) osc_capture_start();
+    
+    // Every frame's buttons and touch, for replay on the host (when enabled)
+    if (g_options.record_input) input_record_start();
+    
+    // Token-bucket pacing of registry sends
+    osc_pacing_start();
+    
+    // Backup / monitor consoles that get every send too
+    osc_targets_start();
+    
+    // Console snapshot slots uploaded in earlier sessions
+    snap_offload_init();
+    
+    // Remote GO/BACK from a show-control machine
+    osc_control_init(g_options.control_port);
+    
     // Mount RomFS for loading embedded assets (required before accessing romfs:/)
     romfsInit();
     
@@ -1213,16 +996,16 @@ void init_graphics(void)
     // Load system font for better text rendering (instead of bitmap fonts)
     g_font = C2D_FontLoadSystem(CFG_REGION_USA);
     if (!g_font) {
-        printf("[WARNING] Failed to load system font, will use default font\n");
+        LOG_WARN("[INIT] Failed to load system font, will use default font");
     } else {
-        printf("[DEBUG] System font loaded successfully\n");
+        LOG_DEBUG("[INIT] System font loaded");
     }
     
     // Ensure sprite sheets are available on SD card (for CIA compatibility)
     ensure_sprite_sheets_on_sd();
     
     // Load fader sprite sheets from romfs (for .3dsx) or /3ds/x18mixer/gfx/ (for CIA on SD card)
-    printf("[DEBUG] Attempting to load spritesheets from romfs:/ or SD card\n");
+    LOG_DEBUG("[INIT] Loading spritesheets from romfs:/ or SD card");
     
     // Try both possible paths: romfs:/gfx/ and romfs:/ (3dsxtool might put files in root)
     g_grip_sheet = C2D_SpriteSheetLoad("romfs:/Grip.t3x");
@@ -1231,14 +1014,14 @@ void init_graphics(void)
     }
     // If RomFS failed, try loading from SD card (CIA doesn't embed RomFS by default)
     if (!g_grip_sheet) {
-        g_grip_sheet = C2D_SpriteSheetLoad("/3ds/x18mixer/gfx/Grip.t3x");
+        g_grip_sheet = C2D_SpriteSheetLoad(PLATFORM_DATA_DIR "/gfx/Grip.t3x");
     }
     if (g_grip_sheet) {
         g_grip_img = C2D_SpriteSheetGetImage(g_grip_sheet, 0);
         g_grip_loaded = 1;
-        printf("[DEBUG] Successfully loaded Grip.t3x\n");
+        LOG_DEBUG("[INIT] Loaded Grip.t3x");
     } else {
-        printf("[DEBUG] Failed to load Grip.t3x from all paths\n");
+        LOG_WARN("[INIT] Failed to load Grip.t3x from all paths");
     }
     
     // Load fader background sprite sheet
@@ -1252,14 +1035,14 @@ void init_graphics(void)
     }
     // If RomFS failed, try loading from SD card
     if (!g_fader_sheet) {
-        g_fader_sheet = C2D_SpriteSheetLoad("/3ds/x18mixer/gfx/FaderBkg.t3x");
+        g_fader_sheet = C2D_SpriteSheetLoad(PLATFORM_DATA_DIR "/gfx/FaderBkg.t3x");
     }
     if (g_fader_sheet) {
         g_fader_bkg = C2D_SpriteSheetGetImage(g_fader_sheet, 0);
         g_fader_loaded = 1;
-        printf("[DEBUG] Successfully loaded FaderBkg.t3x\n");
+        LOG_DEBUG("[INIT] Loaded FaderBkg.t3x");
     } else {
-        printf("[DEBUG] Failed to load FaderBkg.t3x from all paths\n");
+        LOG_WARN("[INIT] Failed to load FaderBkg.t3x from all paths");
     }
     
     g_romfs_mounted = 1;
@@ -1304,8 +1087,30 @@ void cleanup_graphics(void)
     C2D_Fini();
     C3D_Fini();
     
+    // No more remote triggers, then stop fading before the socket goes away
+    osc_control_shutdown();
+    mixer_discovery_shutdown();
+    link_resume_shutdown();
+    snap_offload_shutdown();
+    step_capture_shutdown();
+    go_verify_shutdown();
+    cue_engine_shutdown();
+    link_health_shutdown();
+    osc_query_shutdown();
+    osc_pacing_stop();
+    osc_targets_stop();
+    
     // Shutdown OSC (Phase 1)
     osc_shutdown();
+    osc_capture_stop();
+    input_record_stop();
+    platform_exit();
+    
+    // Keep the last session's timeline for offline inspection
+    TRACE_FLUSH();
+    
+    // Write out whatever is still queued (before the SD service goes away)
+    log_shutdown();
     
     // Unmount RomFS
     romfsExit();
@@ -1382,14 +1187,26 @@ int main(int argc, char* argv[])
     
     while (aptMainLoop())
     {
-        hidScanInput();
+        TRACE_BEGIN("frame");
+        prof_begin(PROF_HID_SCAN);
+        input_scan();
+        prof_end(PROF_HID_SCAN);
+        
+        prof_begin(PROF_TOUCH);
         update_touch_input();
+        prof_end(PROF_TOUCH);
+        
+        u32 kDown = input_keys_down();
+        u32 kHeld = input_keys_held();
         
-        u32 kDown = hidKeysDown();
-        u32 kHeld = hidKeysHeld();
+        prof_begin(PROF_INPUT);
+        TRACE_BEGIN("input");
         
-        // If EQ window is open, handle EQ input instead of normal controls
-        if (g_eq_window_open) {
+        // Profiler combo (ZL+ZR) swallows input for the frame it is held
+        if (prof_handle_input(kDown, kHeld)) {
+            // Nothing else to do
+        } else if (g_eq_window_open) {
+            // If EQ window is open, handle EQ input instead of normal controls
             handle_eq_input(kDown, kHeld);
         } else if (g_options_window_open) {
             // If options window is open, handle options input
@@ -1412,12 +1229,14 @@ int main(int argc, char* argv[])
                 if (g_creating_new_show) {
                     // Handle new show naming input
                     handle_new_show_input();
+                } else if (kHeld & KEY_B) {
+                    // B held: X/Y/L/R edit the step's recall scope
+                    handle_scope_input(kDown);
                 } else {
                     // A button: Send current step OSC data and advance to next step
+                    // (the selection advances below, once the cue engine reports it)
                     if (kDown & KEY_A) {
-                        send_step_osc(g_selected_step);
-                        g_selected_step = (g_selected_step + 1) % g_current_show.num_steps;
-                        apply_step_to_faders(g_selected_step);
+                        go_with_link_check();
                     }
                     
                     // SELECT button: Start creating new show
@@ -1450,6 +1269,15 @@ int main(int argc, char* argv[])
                         save_show_to_file(&g_current_show);
                     }
                     
+                    // Right: capture the console's state into the selected step
+                    if (kDown & KEY_DRIGHT) {
+                        if (step_capture_start(g_selected_step)) {
+                            snprintf(g_save_status, sizeof(g_save_status), "Reading step %d from console...",
+                                     g_selected_step + 1);
+                            g_save_status_timer = 120;
+                        }
+                    }
+                    
                     // L: Add new step
                     if (kDown & KEY_L) {
                         add_step();
@@ -1466,8 +1294,62 @@ int main(int argc, char* argv[])
             }
         }
         
+        // Follow the cue engine: a GO (manual or auto-follow) selects the next step
+        int fired_step;
+        if (cue_take_fired(&fired_step) && g_current_show.num_steps > 0) {
+            g_selected_step = (fired_step + 1) % g_current_show.num_steps;
+            apply_step_to_faders(g_selected_step);
+        }
+        
+        // Console capture finished: the step now holds the console's values
+        StepCaptureReport capture;
+        if (step_capture_finish(&capture)) {
+            if (capture.step_idx == g_selected_step) apply_step_to_faders(g_selected_step);
+            save_show_to_file(&g_current_show);
+            snprintf(g_save_status, sizeof(g_save_status), "%s: step %d %d/%d from console, %lu ms",
+                     (capture.answered == capture.queried) ? "OK" : "ERROR", capture.step_idx + 1,
+                     capture.answered, capture.queried, (unsigned long)(capture.elapsed_us / 1000));
+            g_save_status_timer = 180;
+        }
+        
+        // Link back after sleep / Wi-Fi loss / a new address
+        ResumeReport resume;
+        if (link_resume_take_report(&resume)) {
+            if (resume.answered) {
+                snprintf(g_save_status, sizeof(g_save_status), "OK: %s back in %lu ms", g_mixer_host,
+                         (unsigned long)resume.ready_ms);
+            } else {
+                snprintf(g_save_status, sizeof(g_save_status), "ERROR: no answer from %s", g_mixer_host);
+            }
+            g_save_status_timer = 180;
+        }
+        
+        // Snapshot upload finished
+        SnapUploadReport snap_report;
+        if (snap_offload_take_report(&snap_report)) {
+            if (snap_report.aborted) {
+                snprintf(g_save_status, sizeof(g_save_status), "Snapshot upload stopped (%d in slots)",
+                         snap_report.uploaded);
+            } else if (snap_report.failed) {
+                snprintf(g_save_status, sizeof(g_save_status), "ERROR: %d snapshots not verified",
+                         snap_report.failed);
+            } else {
+                snprintf(g_save_status, sizeof(g_save_status), "OK: %d steps in X18 snapshots",
+                         snap_report.uploaded);
+            }
+            g_save_status_timer = 180;
+        }
+        
+        TRACE_END("input");
+        prof_end(PROF_INPUT);
+        
         render_frame();
+        
+        prof_begin(PROF_VBLANK);
         gspWaitForVBlank();
+        prof_end(PROF_VBLANK);
+        prof_frame_end();
+        TRACE_END("frame");
         
         // Check if we should exit the app
         if (g_should_exit) {
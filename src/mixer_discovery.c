@@ -0,0 +1,250 @@
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "log.h"
+#include "mixer_discovery.h"
+
+#define DISCOVERY_POLL_MS   5
+
+typedef struct {
+    u32 addr;               // Host order, 0 = free
+    u64 deadline;           // System tick
+} Probe;
+
+static Thread s_thread = NULL;
+static LightLock s_lock;            // Guards the results and the status
+static volatile int s_busy = 0;
+static volatile int s_exit = 0;
+
+static DiscoveredMixer s_results[DISCOVERY_MAX];
+static DiscoveryStatus s_status;
+
+static const u8 s_xinfo[8] = { '/', 'x', 'i', 'n', 'f', 'o', 0, 0 };
+
+// ============================================================================
+// SCAN
+// ============================================================================
+
+static u32 elapsed_ms(u64 start)
+{
+    return (u32)((svcGetSystemTick() - start) / CPU_TICKS_PER_MSEC);
+}
+
+static void send_xinfo(int fd, u32 addr)
+{
+    struct sockaddr_in to;
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_port = htons(DISCOVERY_PORT);
+    to.sin_addr.s_addr = htonl(addr);
+    sendto(fd, s_xinfo, sizeof(s_xinfo), 0, (struct sockaddr *)&to, sizeof(to));
+}
+
+static int already_found(u32 addr)
+{
+    char ip[16];
+    struct in_addr in = { htonl(addr) };
+    inet_ntop(AF_INET, &in, ip, sizeof(ip));
+
+    LightLock_Lock(&s_lock);
+    int found = 0;
+    for (int i = 0; i < s_status.found && !found; i++) {
+        found = strcmp(s_results[i].ip, ip) == 0;
+    }
+    LightLock_Unlock(&s_lock);
+    return found;
+}
+
+// Read every pending reply; frees the probe of each host that answered
+static void collect_replies(int fd, Probe *probes, u64 start)
+{
+    u8 buf[256];
+    struct pollfd pfd = { fd, POLLIN, 0 };
+
+    while (poll(&pfd, 1, 0) > 0 && (pfd.revents & POLLIN)) {
+        struct sockaddr_in from;
+        socklen_t from_len = sizeof(from);
+        int len = recvfrom(fd, buf, sizeof(buf), 0, (struct sockaddr *)&from, &from_len);
+        if (len <= 0) break;
+
+        u32 addr = ntohl(from.sin_addr.s_addr);
+        for (int i = 0; i < DISCOVERY_WINDOW; i++) {
+            if (probes[i].addr == addr) probes[i].addr = 0;
+        }
+
+        DiscoveredMixer m;
+        memset(&m, 0, sizeof(m));
+        if (!xinfo_parse(buf, len, &m.info)) continue;
+        inet_ntop(AF_INET, &from.sin_addr, m.ip, sizeof(m.ip));
+        m.rtt_ms = elapsed_ms(start);
+        if (already_found(addr)) continue;
+
+        LightLock_Lock(&s_lock);
+        if (s_status.found < DISCOVERY_MAX) s_results[s_status.found++] = m;
+        LightLock_Unlock(&s_lock);
+        LOG_INFO("[DISCOVERY] %s at %s (%s %s) after %lu ms", m.info.name, m.ip, m.info.model,
+                 m.info.firmware, (unsigned long)m.rtt_ms);
+    }
+}
+
+// The 3DS's address and netmask, host order; 0 if not on a network
+static void scan(int fd)
+{
+    u64 start = svcGetSystemTick();
+    u64 budget = start + (u64)(DISCOVERY_BUDGET_MS * CPU_TICKS_PER_MSEC);
+    u64 probe_ticks = (u64)(DISCOVERY_PROBE_MS * CPU_TICKS_PER_MSEC);
+
+    u32 own, mask;
+    if (!platform_local_subnet(&own, &mask)) {
+        LOG_WARN("[DISCOVERY] No local address, not on a network?");
+        return;
+    }
+    if (~mask > 0xFFu) mask = 0xFFFFFF00u;
+    u32 first = (own & mask) + 1;
+    u32 last = (own | ~mask) - 1;
+
+    // Broadcast first: a console that hears it answers before the sweep gets there
+    send_xinfo(fd, own | ~mask);
+    send_xinfo(fd, INADDR_BROADCAST);
+
+    Probe probes[DISCOVERY_WINDOW];
+    memset(probes, 0, sizeof(probes));
+    u32 next = first;
+    u16 probed = 0;
+
+    while (!s_exit && svcGetSystemTick() < budget) {
+        u64 now = svcGetSystemTick();
+        int in_flight = 0;
+        for (int i = 0; i < DISCOVERY_WINDOW; i++) {
+            if (probes[i].addr && now >= probes[i].deadline) probes[i].addr = 0;
+            if (!probes[i].addr) {
+                while (next <= last && (next == own || already_found(next))) next++;
+                if (next > last) continue;
+                probes[i].addr = next++;
+                probes[i].deadline = now + probe_ticks;
+                send_xinfo(fd, probes[i].addr);
+                probed++;
+            }
+            in_flight++;
+        }
+
+        LightLock_Lock(&s_lock);
+        s_status.probed = probed;
+        s_status.elapsed_ms = elapsed_ms(start);
+        LightLock_Unlock(&s_lock);
+
+        // Sweep done and every probe answered or timed out
+        if (in_flight == 0 && next > last) break;
+
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        poll(&pfd, 1, DISCOVERY_POLL_MS);
+        collect_replies(fd, probes, start);
+    }
+}
+
+static void discovery_thread_main(void *arg)
+{
+    (void)arg;
+    u64 start = svcGetSystemTick();
+
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        LOG_ERROR("[DISCOVERY] socket() failed");
+    } else {
+        int on = 1;
+        setsockopt(fd, SOL_SOCKET, SO_BROADCAST, &on, sizeof(on));
+        struct sockaddr_in local;
+        memset(&local, 0, sizeof(local));
+        local.sin_family = AF_INET;
+        local.sin_addr.s_addr = htonl(INADDR_ANY);
+        bind(fd, (struct sockaddr *)&local, sizeof(local));
+
+        scan(fd);
+        close(fd);
+    }
+
+    LightLock_Lock(&s_lock);
+    s_status.elapsed_ms = elapsed_ms(start);
+    s_status.running = 0;
+    LOG_INFO("[DISCOVERY] %u found, %u probed in %lu ms", s_status.found, s_status.probed,
+             (unsigned long)s_status.elapsed_ms);
+    LightLock_Unlock(&s_lock);
+    s_busy = 0;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+int mixer_discovery_start(void)
+{
+    static int s_lock_ready = 0;
+    if (!s_lock_ready) {
+        LightLock_Init(&s_lock);
+        s_lock_ready = 1;
+    }
+    if (s_busy) return 0;
+
+    // Reap the previous scan's thread
+    if (s_thread) {
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    }
+
+    memset(s_results, 0, sizeof(s_results));
+    memset(&s_status, 0, sizeof(s_status));
+    s_status.running = 1;
+    s_exit = 0;
+    s_busy = 1;
+
+    // Below the main loop: the window keeps drawing while the scan runs
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    s_thread = threadCreate(discovery_thread_main, NULL, 8 * 1024, prio + 1, -2, false);
+    if (!s_thread) {
+        LOG_ERROR("[DISCOVERY] Scan thread not started");
+        s_status.running = 0;
+        s_busy = 0;
+        return 0;
+    }
+    return 1;
+}
+
+void mixer_discovery_shutdown(void)
+{
+    if (s_thread) {
+        s_exit = 1;
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    }
+    s_busy = 0;
+}
+
+void mixer_discovery_status(DiscoveryStatus *out)
+{
+    if (!s_thread) {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    LightLock_Lock(&s_lock);
+    *out = s_status;
+    LightLock_Unlock(&s_lock);
+}
+
+int mixer_discovery_results(DiscoveredMixer *out, int max)
+{
+    if (!s_thread) return 0;
+
+    LightLock_Lock(&s_lock);
+    int n = (s_status.found < max) ? s_status.found : max;
+    memcpy(out, s_results, n * sizeof(DiscoveredMixer));
+    LightLock_Unlock(&s_lock);
+    return n;
+}
@@ -0,0 +1,43 @@
+#ifndef MIXER_DISCOVERY_H
+#define MIXER_DISCOVERY_H
+
+#include "platform.h"
+#include "link_health.h"
+
+// ============================================================================
+// MIXER DISCOVERY
+// ============================================================================
+// Finds X-Air consoles on the local subnet instead of typing an address.
+// A scan thread broadcasts /xinfo and, in parallel, sweeps the subnet with
+// unicast /xinfo probes (access points often drop broadcasts), at most
+// DISCOVERY_WINDOW in flight, each given DISCOVERY_PROBE_MS to answer.
+// Whatever answered within DISCOVERY_BUDGET_MS is the result. Subnets larger
+// than a /24 are swept only in the 3DS's own /24.
+
+#define DISCOVERY_PORT          10023
+#define DISCOVERY_BUDGET_MS     900
+#define DISCOVERY_WINDOW        64
+#define DISCOVERY_PROBE_MS      120
+#define DISCOVERY_MAX           8
+
+typedef struct {
+    char ip[16];            // Where the reply came from
+    MixerInfo info;
+    u32 rtt_ms;             // From the start of the scan
+} DiscoveredMixer;
+
+typedef struct {
+    u16 probed;             // Unicast probes sent
+    u8 found;
+    u8 running;
+    u32 elapsed_ms;
+} DiscoveryStatus;
+
+int mixer_discovery_start(void);           // 0 if a scan is already running
+void mixer_discovery_shutdown(void);
+
+void mixer_discovery_status(DiscoveryStatus *out);
+// Copies up to max results (in order of reply), returns the count
+int mixer_discovery_results(DiscoveredMixer *out, int max);
+
+#endif
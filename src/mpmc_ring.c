@@ -0,0 +1,74 @@
+#include "mpmc_ring.h"
+
+// ============================================================================
+// PRODUCERS
+// ============================================================================
+
+void mpmc_ring_init(MpmcRing *ring, u32 *seq, void *slots, u32 size, u32 slot_size)
+{
+    for (u32 i = 0; i < size; i++) {
+        seq[i] = i;
+    }
+    ring->seq = seq;
+    ring->slots = (u8 *)slots;
+    ring->size = size;
+    ring->slot_size = slot_size;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->dropped = 0;
+}
+
+void *mpmc_ring_claim(MpmcRing *ring, u32 *out_pos)
+{
+    u32 pos = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+
+    for (;;) {
+        u32 idx = pos & (ring->size - 1);
+        u32 seq = __atomic_load_n(&ring->seq[idx], __ATOMIC_ACQUIRE);
+        s32 diff = (s32)(seq - pos);
+
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&ring->head, &pos, pos + 1, 1,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                *out_pos = pos;
+                return ring->slots + (size_t)idx * ring->slot_size;
+            }
+        } else if (diff < 0) {
+            // Ring full: never block the producer
+            __atomic_add_fetch(&ring->dropped, 1, __ATOMIC_RELAXED);
+            return NULL;
+        } else {
+            pos = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+int mpmc_ring_publish(MpmcRing *ring, u32 pos)
+{
+    __atomic_store_n(&ring->seq[pos & (ring->size - 1)], pos + 1, __ATOMIC_RELEASE);
+    return (pos - __atomic_load_n(&ring->tail, __ATOMIC_RELAXED)) == ring->size / 2;
+}
+
+u32 mpmc_ring_dropped(const MpmcRing *ring)
+{
+    return __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED);
+}
+
+// ============================================================================
+// CONSUMER
+// ============================================================================
+
+void *mpmc_ring_peek(MpmcRing *ring)
+{
+    u32 idx = ring->tail & (ring->size - 1);
+    u32 seq = __atomic_load_n(&ring->seq[idx], __ATOMIC_ACQUIRE);
+    if (seq != ring->tail + 1) return NULL;     // Empty (or producer still writing)
+    return ring->slots + (size_t)idx * ring->slot_size;
+}
+
+void mpmc_ring_release(MpmcRing *ring)
+{
+    u32 idx = ring->tail & (ring->size - 1);
+    __atomic_store_n(&ring->seq[idx], ring->tail + ring->size, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->tail, ring->tail + 1, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,44 @@
+#ifndef MPMC_RING_H
+#define MPMC_RING_H
+
+#include "platform.h"
+
+// ============================================================================
+// LOCK-FREE RING
+// ============================================================================
+// Bounded MPMC queue of fixed-size records: each slot has a sequence number
+// telling producers and the consumer whose turn it is, so neither side ever
+// takes a lock. Any thread may produce; a full ring drops the record and
+// counts it rather than block. One thread drains. The log and the OSC
+// capture both queue through it.
+//
+//   void *slot = mpmc_ring_claim(&ring, &pos);     // NULL: full, dropped
+//   ... fill slot ...
+//   if (mpmc_ring_publish(&ring, pos)) wake the consumer;
+//
+//   while ((slot = mpmc_ring_peek(&ring))) { ... ; mpmc_ring_release(&ring); }
+
+typedef struct {
+    u32 *seq;               // One per slot
+    u8 *slots;              // size * slot_size bytes
+    u32 size;               // Slots, must be a power of two
+    u32 slot_size;
+    u32 head;               // Next slot to claim (producers)
+    u32 tail;               // Next slot to drain (consumer only)
+    u32 dropped;
+} MpmcRing;
+
+// Storage stays the caller's (usually static arrays); also empties the ring
+void mpmc_ring_init(MpmcRing *ring, u32 *seq, void *slots, u32 size, u32 slot_size);
+
+void *mpmc_ring_claim(MpmcRing *ring, u32 *out_pos);
+// 1 when this record filled the ring to half: time to wake the consumer
+int mpmc_ring_publish(MpmcRing *ring, u32 pos);
+u32 mpmc_ring_dropped(const MpmcRing *ring);
+
+// Consumer: the oldest published record (NULL if none or still being
+// written), handed back with mpmc_ring_release() once used
+void *mpmc_ring_peek(MpmcRing *ring);
+void mpmc_ring_release(MpmcRing *ring);
+
+#endif
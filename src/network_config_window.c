@@ -1,8 +1,32 @@
 #include "common.h"
 #include "network_config_window.h"
+#include "mixer_discovery.h"
 
 // Touch debounce tracking
 static int g_net_touch_was_active = 0;
+
+// Pick list entry shown as selected (-1 = none picked yet)
+static int g_net_pick = -1;
+
+// Fill the fields with the next mixer the scan found
+static void pick_next_mixer(void)
+{
+    DiscoveredMixer found[DISCOVERY_MAX];
+    int n = mixer_discovery_results(found, DISCOVERY_MAX);
+    if (n == 0) return;
+    
+    g_net_pick = (g_net_pick + 1) % n;
+    snprintf(g_net_ip_input, sizeof(g_net_ip_input), "%s", found[g_net_pick].ip);
+    snprintf(g_net_port_input, sizeof(g_net_port_input), "%d", DISCOVERY_PORT);
+}
+
+// Start a scan for the pick list (also when the window opens)
+void start_mixer_scan(void)
+{
+    if (mixer_discovery_start()) {
+        g_net_pick = -1;
+    }
+}
 int is_valid_ip(const char *ip)
 {
     if (!ip || strlen(ip) == 0) return 0;
@@ -105,7 +129,31 @@ void render_net_config_window(void)
     draw_debug_text(&g_topScreen, status_text, 20, port_y + 40, 0.50f, status_color);
     
     // Instructions
-    draw_debug_text(&g_topScreen, "D-Pad: Navigate  A: Press  B: Cancel", 20, port_y + 60, 0.50f, CLR_TEXT_SECONDARY);
+    draw_debug_text(&g_topScreen, "D-Pad: Navigate  A: Press  X: Pick  B: Cancel", 20, port_y + 60, 0.50f, CLR_TEXT_SECONDARY);
+    
+    // Pick list: mixers that answered the scan, two around the picked one
+    DiscoveryStatus scan;
+    mixer_discovery_status(&scan);
+    DiscoveredMixer found[DISCOVERY_MAX];
+    int num_found = mixer_discovery_results(found, DISCOVERY_MAX);
+    float list_y = port_y + 80;
+    char line[96];
+    if (scan.running) {
+        snprintf(line, sizeof(line), "Scanning... %d found, %u probed", num_found, scan.probed);
+    } else {
+        snprintf(line, sizeof(line), "%d mixer%s found in %lu ms", num_found, num_found == 1 ? "" : "s",
+                 (unsigned long)scan.elapsed_ms);
+    }
+    draw_debug_text(&g_topScreen, line, 20, list_y, 0.40f, num_found ? CLR_BORDER_GREEN : CLR_TEXT_SECONDARY);
+    
+    int first = (g_net_pick > 0) ? g_net_pick - 1 : 0;
+    if (first > num_found - 2) first = (num_found > 2) ? num_found - 2 : 0;
+    for (int i = first; i < num_found && i < first + 2; i++) {
+        snprintf(line, sizeof(line), "%s %s  %s %s", (i == g_net_pick) ? ">" : " ", found[i].ip,
+                 found[i].info.name, found[i].info.model);
+        draw_debug_text(&g_topScreen, line, 20, list_y + 13 + (i - first) * 13, 0.40f,
+                        (i == g_net_pick) ? CLR_BORDER_YELLOW : CLR_TEXT_PRIMARY);
+    }
     
     // BOTTOM SCREEN ==========================================================
     C2D_TargetClear(g_botScreen.target, CLR_BG_PRIMARY);
@@ -174,6 +222,11 @@ void render_net_config_window(void)
     draw_key_3d(keypad_x + key_spacing * 3, row3_y, key_w, key_h, save_color);
     draw_debug_text(&g_botScreen, "SAVE", keypad_x + key_spacing * 3 + 9, row3_y + 12, 0.50f, CLR_TEXT_PRIMARY);
     
+    int is_scan_selected = (g_net_keyboard_selected == 14);
+    u32 scan_color = is_scan_selected ? CLR_BORDER_CYAN : CLR_BG_SECONDARY;
+    draw_key_3d(keypad_x + key_spacing * 4, row3_y, key_w, key_h, scan_color);
+    draw_debug_text(&g_botScreen, "SCAN", keypad_x + key_spacing * 4 + 9, row3_y + 12, 0.50f, CLR_TEXT_PRIMARY);
+    
     // Instructions
     float instr_y = row3_y + key_spacing + 5.0f;
     draw_debug_text(&g_botScreen, "D-Pad: Navigate  A: Press key  B: Cancel", 10, instr_y, 0.50f, CLR_TEXT_SECONDARY);
@@ -188,6 +241,12 @@ void handle_net_config_input(u32 kDown)
         return;
     }
     
+    // X: take the next mixer from the pick list
+    if (kDown & KEY_X) {
+        pick_next_mixer();
+        return;
+    }
+    
     // D-Pad to navigate keyboard
     if (kDown & KEY_DLEFT) {
         if (g_net_keyboard_selected > 0) {
@@ -197,7 +256,7 @@ void handle_net_config_input(u32 kDown)
     }
     
     if (kDown & KEY_DRIGHT) {
-        if (g_net_keyboard_selected < 13) {
+        if (g_net_keyboard_selected < 14) {
             g_net_keyboard_selected++;
         }
         return;
@@ -219,7 +278,7 @@ void handle_net_config_input(u32 kDown)
             } else {
                 g_net_keyboard_selected = 10 + (g_net_keyboard_selected - 5);
             }
-        } else if (g_net_keyboard_selected < 13) {
+        } else if (g_net_keyboard_selected < 14) {
             g_net_keyboard_selected++;
         }
         return;
@@ -271,6 +330,9 @@ void handle_net_config_input(u32 kDown)
             // SAVE pressed: save and close
             save_network_config();
             g_net_config_open = 0;
+        } else if (g_net_keyboard_selected == 14) {
+            // SCAN pressed: look for mixers again
+            start_mixer_scan();
         }
         return;
     }
@@ -322,7 +384,7 @@ void handle_net_config_touch(touchPosition touch)
     
     // Skip if not in keyboard area
     if (py_local < 55.0f || py_local >= 195.0f) return;
-    if (touch.px < 5.0f || touch.px >= 250.0f) return;
+    if (touch.px < 5.0f || touch.px >= 255.0f) return;
     
     // Use same layout as rendering
     float keypad_x = 5.0f;
@@ -356,13 +418,13 @@ void handle_net_config_touch(touchPosition touch)
         }
     }
     
-    // Row 3: ., DEL, TAB, SAVE (y: 155-195)
+    // Row 3: ., DEL, TAB, SAVE, SCAN (y: 155-195)
     float row3_y = row2_y + key_spacing;
     if (py_local >= row3_y && py_local < row3_y + key_h) {
-        for (int col = 0; col < 4; col++) {
+        for (int col = 0; col < 5; col++) {
             float key_x = keypad_x + col * key_spacing;
             if (touch.px >= key_x && touch.px < key_x + key_w) {
-                g_net_keyboard_selected = 10 + col;  // Key 10-13
+                g_net_keyboard_selected = 10 + col;  // Key 10-14
                 handle_net_config_input(KEY_A);
                 return;
             }
@@ -25,5 +25,6 @@ void load_network_config(void);
 void save_network_config(void);
 void load_network_config_from_file(void);
 int is_valid_ip(const char *ip);
+void start_mixer_scan(void);
 
 #endif
@@ -0,0 +1,154 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "options.h"
+
+// ============================================================================
+// GLOBAL STATE
+// ============================================================================
+
+Options g_options = {1, 1};  // Default: both enabled
+
+#define OPTIONS_FILE PLATFORM_DATA_DIR "/Options"
+
+// ============================================================================
+// FILE I/O FUNCTIONS
+// ============================================================================
+
+void init_options(void)
+{
+    g_options.send_fader = 1;
+    g_options.send_eq = 1;
+    g_options.skip_unchanged = 0;
+    g_options.snap_offload = 0;
+    g_options.verify_go = 0;
+    g_options.pace_rate = 1000;
+    g_options.pace_burst = 32;
+    g_options.pace_adaptive = 1;
+    g_options.control_port = 0;        // Opt-in: any sender on the network can fire cues
+    memset(g_options.targets, 0, sizeof(g_options.targets));
+    g_options.capture = 0;
+    g_options.record_input = 0;
+}
+
+void load_options(void)
+{
+    FILE *f = fopen(OPTIONS_FILE, "r");
+    if (!f) {
+        init_options();
+        return;
+    }
+    
+    char line[256];
+    char section[64] = {0};
+    
+    while (fgets(line, sizeof(line), f)) {
+        // Skip empty lines and comments
+        if (line[0] == '\0' || line[0] == '#' || line[0] == ';') continue;
+        
+        // Parse section header [SECTION]
+        if (line[0] == '[') {
+            int len = 0;
+            for (int i = 1; line[i] != ']' && line[i] != '\0' && len < 63; i++) {
+                section[len++] = line[i];
+            }
+            section[len] = '\0';
+            continue;
+        }
+        
+        // Parse key=value pairs
+        if (strcmp(section, "OSC_SEND") == 0) {
+            char key[32], value[32];
+            if (sscanf(line, "%31[^=]=%31s", key, value) == 2) {
+                if (strcmp(key, "fader") == 0) {
+                    g_options.send_fader = atoi(value);
+                } else if (strcmp(key, "eq") == 0) {
+                    g_options.send_eq = atoi(value);
+                } else if (strcmp(key, "skip_unchanged") == 0) {
+                    g_options.skip_unchanged = atoi(value);
+                } else if (strcmp(key, "snap_offload") == 0) {
+                    g_options.snap_offload = atoi(value);
+                } else if (strcmp(key, "verify") == 0) {
+                    g_options.verify_go = atoi(value);
+                }
+            }
+        } else if (strcmp(section, "OSC_PACER") == 0) {
+            char key[32], value[32];
+            if (sscanf(line, "%31[^=]=%31s", key, value) == 2) {
+                if (strcmp(key, "rate") == 0) {
+                    g_options.pace_rate = atoi(value);
+                } else if (strcmp(key, "burst") == 0) {
+                    g_options.pace_burst = atoi(value);
+                } else if (strcmp(key, "adaptive") == 0) {
+                    g_options.pace_adaptive = atoi(value);
+                }
+            }
+        } else if (strcmp(section, "OSC_CONTROL") == 0) {
+            char key[32], value[32];
+            if (sscanf(line, "%31[^=]=%31s", key, value) == 2) {
+                if (strcmp(key, "port") == 0) {
+                    g_options.control_port = atoi(value);
+                }
+            }
+        } else if (strcmp(section, "OSC_TARGETS") == 0) {
+            char key[32], value[32];
+            int n;
+            if (sscanf(line, "%31[^=]=%31s", key, value) == 2 &&
+                sscanf(key, "target%d", &n) == 1 && n >= 1 && n <= OPTIONS_MAX_TARGETS) {
+                snprintf(g_options.targets[n - 1], sizeof(g_options.targets[n - 1]), "%.*s",
+                         (int)sizeof(g_options.targets[n - 1]) - 1, value);
+            }
+        } else if (strcmp(section, "OSC_CAPTURE") == 0) {
+            char key[32], value[32];
+            if (sscanf(line, "%31[^=]=%31s", key, value) == 2) {
+                if (strcmp(key, "enabled") == 0) {
+                    g_options.capture = atoi(value);
+                }
+            }
+        } else if (strcmp(section, "INPUT") == 0) {
+            char key[32], value[32];
+            if (sscanf(line, "%31[^=]=%31s", key, value) == 2) {
+                if (strcmp(key, "record") == 0) {
+                    g_options.record_input = atoi(value);
+                }
+            }
+        }
+    }
+    
+    fclose(f);
+}
+
+void save_options(void)
+{
+    FILE *f = fopen(OPTIONS_FILE, "w");
+    if (!f) return;
+    
+    fprintf(f, "# X18 Mixer Options\n");
+    fprintf(f, "# Auto-generated - do not edit manually\n\n");
+    fprintf(f, "[OSC_SEND]\n");
+    fprintf(f, "fader=%d\n", g_options.send_fader);
+    fprintf(f, "eq=%d\n", g_options.send_eq);
+    fprintf(f, "skip_unchanged=%d\n", g_options.skip_unchanged);
+    fprintf(f, "snap_offload=%d\n", g_options.snap_offload);
+    fprintf(f, "verify=%d\n", g_options.verify_go);
+    fprintf(f, "\n[OSC_PACER]\n");
+    fprintf(f, "rate=%d\n", g_options.pace_rate);
+    fprintf(f, "burst=%d\n", g_options.pace_burst);
+    fprintf(f, "adaptive=%d\n", g_options.pace_adaptive);
+    fprintf(f, "\n[OSC_CONTROL]\n");
+    fprintf(f, "port=%d\n", g_options.control_port);
+    fprintf(f, "\n[OSC_TARGETS]\n");
+    for (int i = 0; i < OPTIONS_MAX_TARGETS; i++) {
+        fprintf(f, "target%d=%s\n", i + 1, g_options.targets[i]);
+    }
+    fprintf(f, "\n[OSC_CAPTURE]\n");
+    fprintf(f, "enabled=%d\n", g_options.capture);
+    fprintf(f, "\n[INPUT]\n");
+    fprintf(f, "record=%d\n", g_options.record_input);
+    
+    fflush(f);
+    fsync(fileno(f));
+    fclose(f);
+}
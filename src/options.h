@@ -0,0 +1,32 @@
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include "platform.h"
+
+// Options structure
+#define OPTIONS_MAX_TARGETS 3    // Consoles sent to besides the mixer address (osc_targets.h)
+
+typedef struct {
+    int send_fader;
+    int send_eq;
+    int skip_unchanged;     // Skip values already on the console (file only, no UI)
+    int snap_offload;       // Recall uploaded steps as console snapshots (snap_offload.h)
+    int verify_go;          // Read back and repair each GO (go_verify.h, file only, no UI)
+    int pace_rate;          // Paced packets/s, 0 = off (osc_pacer.h, file only, no UI)
+    int pace_burst;
+    int pace_adaptive;
+    int control_port;       // Inbound OSC control port, 0 = off (file only, no UI)
+    char targets[OPTIONS_MAX_TARGETS][24];  // "ip" or "ip:port", "" = unused (file only, no UI)
+    int capture;            // Record every OSC packet (osc_capture.h, file only, no UI)
+    int record_input;       // Record buttons and touch (input.h, file only, no UI)
+} Options;
+
+// Global options
+extern Options g_options;
+
+// Options file I/O (PLATFORM_DATA_DIR/Options)
+void init_options(void);
+void load_options(void);
+void save_options(void);
+
+#endif
@@ -1,16 +1,14 @@
 #include "common.h"
 #include "options_window.h"
+#include "snap_offload.h"
 #include <unistd.h>
 
 // ============================================================================
 // GLOBAL STATE
 // ============================================================================
 
-Options g_options = {1, 1};  // Default: both enabled
 int g_options_window_open = 0;
-int g_options_selected_checkbox = 0;  // 0=fader, 1=eq
-
-#define OPTIONS_FILE "/3ds/x18mixer/Options"
+int g_options_selected_checkbox = 0;  // 0=fader, 1=eq, 2=snapshot offload
 
 // ============================================================================
 // WINDOW LAYOUT CONSTANTS
@@ -26,8 +24,10 @@ int g_options_selected_checkbox = 0;  // 0=fader, 1=eq
 #define CHECKBOX_X 30.0f
 #define LABEL_WIDTH 50.0f
 
-#define CHECKBOX1_Y 110.0f
-#define CHECKBOX2_Y 160.0f
+#define CHECKBOX1_Y 90.0f
+#define CHECKBOX2_Y 128.0f
+#define CHECKBOX3_Y 166.0f
+#define NUM_CHECKBOXES 3
 
 // ============================================================================
 // COLOR PALETTE
@@ -42,74 +42,6 @@ int g_options_selected_checkbox = 0;  // 0=fader, 1=eq
 #define CLR_CHECKMARK C2D_Color32(0x00, 0xFF, 0x00, 0xFF)   // Green
 #define CLR_X C2D_Color32(0xFF, 0x00, 0x00, 0xFF)           // Red
 
-// ============================================================================
-// FILE I/O FUNCTIONS
-// ============================================================================
-
-void init_options(void)
-{
-    g_options.send_fader = 1;
-    g_options.send_eq = 1;
-    g_options_selected_checkbox = 0;
-}
-
-void load_options(void)
-{
-    FILE *f = fopen(OPTIONS_FILE, "r");
-    if (!f) {
-        init_options();
-        return;
-    }
-    
-    char line[256];
-    char section[64] = {0};
-    
-    while (fgets(line, sizeof(line), f)) {
-        // Skip empty lines and comments
-        if (line[0] == '\0' || line[0] == '#' || line[0] == ';') continue;
-        
-        // Parse section header [SECTION]
-        if (line[0] == '[') {
-            int len = 0;
-            for (int i = 1; line[i] != ']' && line[i] != '\0' && len < 63; i++) {
-                section[len++] = line[i];
-            }
-            section[len] = '\0';
-            continue;
-        }
-        
-        // Parse key=value pairs
-        if (strcmp(section, "OSC_SEND") == 0) {
-            char key[32], value[32];
-            if (sscanf(line, "%31[^=]=%31s", key, value) == 2) {
-                if (strcmp(key, "fader") == 0) {
-                    g_options.send_fader = atoi(value);
-                } else if (strcmp(key, "eq") == 0) {
-                    g_options.send_eq = atoi(value);
-                }
-            }
-        }
-    }
-    
-    fclose(f);
-}
-
-void save_options(void)
-{
-    FILE *f = fopen(OPTIONS_FILE, "w");
-    if (!f) return;
-    
-    fprintf(f, "# X18 Mixer Options\n");
-    fprintf(f, "# Auto-generated - do not edit manually\n\n");
-    fprintf(f, "[OSC_SEND]\n");
-    fprintf(f, "fader=%d\n", g_options.send_fader);
-    fprintf(f, "eq=%d\n", g_options.send_eq);
-    
-    fflush(f);
-    fsync(fileno(f));
-    fclose(f);
-}
-
 // ============================================================================
 // RENDERING HELPERS
 // ============================================================================
@@ -165,6 +97,7 @@ void render_options_window(void)
     // Draw checkbox items with 3D styling (centered on screen)
     draw_checkbox_item(CHECKBOX_X, CHECKBOX1_Y, "FADER", g_options.send_fader, (g_options_selected_checkbox == 0));
     draw_checkbox_item(CHECKBOX_X, CHECKBOX2_Y, "EQUALIZER", g_options.send_eq, (g_options_selected_checkbox == 1));
+    draw_checkbox_item(CHECKBOX_X, CHECKBOX3_Y, "SNAPSHOT X18", g_options.snap_offload, (g_options_selected_checkbox == 2));
     
     // Draw info message at bottom
     draw_debug_text(&g_botScreen, "I mute dei canali verranno sempre inviati", 15.0f, SCREEN_HEIGHT_BOT - 35, 0.50f, CLR_TEXT_SECONDARY);
@@ -177,26 +110,40 @@ void render_options_window(void)
 // INPUT HANDLING
 // ============================================================================
 
+static void toggle_option(int checkbox)
+{
+    if (checkbox == 0) {
+        g_options.send_fader = 1 - g_options.send_fader;
+    } else if (checkbox == 1) {
+        g_options.send_eq = 1 - g_options.send_eq;
+    } else {
+        // Switching offload on uploads the show into the console's snapshots
+        g_options.snap_offload = 1 - g_options.snap_offload;
+        if (g_options.snap_offload) {
+            snap_offload_start();
+        } else {
+            snap_offload_stop();
+        }
+    }
+    g_options_selected_checkbox = checkbox;
+    save_options();
+}
+
 void handle_options_input(u32 kDown)
 {
     if (!g_options_window_open) return;
     
     // D-Pad navigation
-    if (kDown & KEY_UP) {
-        g_options_selected_checkbox = 0;
+    if ((kDown & KEY_UP) && g_options_selected_checkbox > 0) {
+        g_options_selected_checkbox--;
     }
-    if (kDown & KEY_DOWN) {
-        g_options_selected_checkbox = 1;
+    if ((kDown & KEY_DOWN) && g_options_selected_checkbox < NUM_CHECKBOXES - 1) {
+        g_options_selected_checkbox++;
     }
     
     // A button: toggle selected option
     if (kDown & KEY_A) {
-        if (g_options_selected_checkbox == 0) {
-            g_options.send_fader = 1 - g_options.send_fader;
-        } else {
-            g_options.send_eq = 1 - g_options.send_eq;
-        }
-        save_options();
+        toggle_option(g_options_selected_checkbox);
     }
     
     // B button: close window
@@ -209,20 +156,12 @@ void handle_options_input(u32 kDown)
         float touch_x = g_touchPos.px;
         float touch_y = g_touchPos.py;
         
-        // Check if touch is on checkbox 1
-        if (touch_x >= CHECKBOX_X && touch_x < CHECKBOX_X + CHECKBOX_SIZE &&
-            touch_y >= CHECKBOX1_Y && touch_y < CHECKBOX1_Y + CHECKBOX_SIZE) {
-            g_options.send_fader = 1 - g_options.send_fader;
-            g_options_selected_checkbox = 0;
-            save_options();
-        }
-        
-        // Check if touch is on checkbox 2
-        if (touch_x >= CHECKBOX_X && touch_x < CHECKBOX_X + CHECKBOX_SIZE &&
-            touch_y >= CHECKBOX2_Y && touch_y < CHECKBOX2_Y + CHECKBOX_SIZE) {
-            g_options.send_eq = 1 - g_options.send_eq;
-            g_options_selected_checkbox = 1;
-            save_options();
+        static const float checkbox_y[NUM_CHECKBOXES] = { CHECKBOX1_Y, CHECKBOX2_Y, CHECKBOX3_Y };
+        for (int i = 0; i < NUM_CHECKBOXES; i++) {
+            if (touch_x >= CHECKBOX_X && touch_x < CHECKBOX_X + CHECKBOX_SIZE &&
+                touch_y >= checkbox_y[i] && touch_y < checkbox_y[i] + CHECKBOX_SIZE) {
+                toggle_option(i);
+            }
         }
     }
 }
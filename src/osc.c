@@ -0,0 +1,276 @@
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "log.h"
+#include "param.h"
+#include "fader_taper.h"
+#include "trace.h"
+#include "options.h"
+#include "osc.h"
+#include "osc_pacer.h"
+#include "osc_targets.h"
+#include "osc_capture.h"
+#include "link_resume.h"
+
+struct sockaddr_in g_mixer_addr = {0};
+char g_mixer_host[16] = "10.10.99.112";
+int g_mixer_port = 10023;
+int g_osc_connected = 0;
+int g_osc_socket = -1;
+
+static OscPacer *s_pacer = NULL;
+static volatile u32 s_send_errors = 0;
+
+// ============================================================================
+// OSC CORE FUNCTIONS (Phase 1 - Send Only)
+// ============================================================================
+
+// UDP socket bound to an ephemeral port (query replies come back to it)
+static int open_socket(void)
+{
+    int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    LOG_DEBUG("[OSC_INIT] socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP) returned: %d", fd);
+    if (fd < 0) {
+        LOG_ERROR("[OSC_INIT] Failed to create socket");
+        return -1;
+    }
+    
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = 0;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (struct sockaddr*)&local, sizeof(local)) < 0) {
+        LOG_WARN("[OSC_INIT] bind() failed, console replies may not arrive");
+    }
+    return fd;
+}
+
+// g_mixer_host:g_mixer_port as a socket address; 0 if the host does not parse
+static int mixer_address(struct sockaddr_in *addr)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->sin_family = AF_INET;
+    addr->sin_port = htons(g_mixer_port);
+    
+    LOG_DEBUG("[OSC_INIT] Parsing IP: '%s' (len=%d), Port: %d", g_mixer_host, (int)strlen(g_mixer_host), g_mixer_port);
+    int ret = inet_pton(AF_INET, g_mixer_host, &addr->sin_addr);
+    if (ret <= 0) {
+        LOG_ERROR("[OSC_INIT] Invalid IP address: '%s' (ret=%d)", g_mixer_host, ret);
+        return 0;
+    }
+    return 1;
+}
+
+// Initialize OSC connection
+void osc_init(void)
+{
+    LOG_INFO("[OSC_INIT] Starting OSC initialization...");
+    
+    // Nothing is known about the console's state on a fresh link
+    xair_codec_init();
+    xair_shadow_reset();
+    
+    if (!mixer_address(&g_mixer_addr)) return;
+    
+    g_osc_socket = open_socket();
+    if (g_osc_socket < 0) return;
+    
+    g_osc_connected = 1;
+    LOG_INFO("[OSC_INIT] Connected to %s:%d, socket=%d", g_mixer_host, g_mixer_port, g_osc_socket);
+}
+
+// New socket (and address) after sleep, Wi-Fi loss or an address change.
+// The new socket is in place before the old one closes, so the pacer and
+// the query thread (which re-read g_osc_socket) never see -1 in between.
+int osc_reconnect(void)
+{
+    struct sockaddr_in addr;
+    if (!mixer_address(&addr)) {
+        g_osc_connected = 0;
+        return 0;
+    }
+    
+    int fd = open_socket();
+    if (fd < 0) return 0;
+    
+    int old = g_osc_socket;
+    g_mixer_addr = addr;
+    g_osc_socket = fd;
+    g_osc_connected = 1;
+    if (old >= 0) close(old);
+    
+    // Whatever the console held before may be gone (or it is another console)
+    xair_shadow_reset();
+    LOG_INFO("[OSC] Reconnected to %s:%d, socket=%d", g_mixer_host, g_mixer_port, fd);
+    return 1;
+}
+
+u32 osc_send_errors(void)
+{
+    return s_send_errors;
+}
+
+// Send OSC message (generic)
+int osc_send(const uint8_t *packet, int packet_size)
+{
+    if (g_osc_socket < 0 || !g_osc_connected) {
+        return -1;
+    }
+    
+    TRACE_BEGIN("osc_send");
+    int n = sendto(g_osc_socket, packet, packet_size, 0, 
+                   (struct sockaddr*)&g_mixer_addr, sizeof(g_mixer_addr));
+    TRACE_END("osc_send");
+    if (n > 0) osc_capture_packet(CAPTURE_LINK_MIXER, 0, packet, n);
+    
+    // A full buffer is transient; anything else means the socket is gone
+    // (typically after sleep or Wi-Fi loss) and has to be re-created
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != ENOBUFS) {
+        s_send_errors++;
+        link_resume_request(RESUME_SOCKET_ERROR);
+    }
+    
+    return n;
+}
+
+static int pacer_send(void *ctx, const u8 *packet, int len)
+{
+    (void)ctx;
+    return osc_send(packet, len);
+}
+
+// Start pacing registry sends with the configured token bucket (osc_pacer.h)
+void osc_pacing_start(void)
+{
+    OscPacerConfig config = {
+        (u32)g_options.pace_rate, (u32)g_options.pace_burst, g_options.pace_adaptive
+    };
+    s_pacer = osc_pacer_create(&config, pacer_send, NULL);
+}
+
+void osc_pacing_stop(void)
+{
+    osc_pacer_destroy(s_pacer);
+    s_pacer = NULL;
+}
+
+OscPacer *osc_pacer(void)
+{
+    return s_pacer;
+}
+
+// Send one registry parameter (see param.h), through the pacer when on.
+// The same encoded packet goes to every fan-out target (osc_targets.h).
+int osc_send_param(u16 id, int step)
+{
+    u8 packet[PARAM_PACKET_MAX];
+    int len = param_encode(id, step, packet, sizeof(packet));
+    if (len <= 0) {
+        LOG_WARN("[OSC] Cannot encode param 0x%04X step %d", id, step);
+        return -1;
+    }
+    osc_targets_fanout(id, packet, len);
+    if (s_pacer && g_osc_connected && osc_pacer_enqueue(s_pacer, id, packet, len)) {
+        return len;
+    }
+    return osc_send(packet, len);
+}
+
+// Send a string registry parameter (snapshot names...)
+int osc_send_param_string(u16 id, const char *value)
+{
+    const ParamTemplate *t = param_template(id);
+    if (!t || t->type != 's') return -1;
+    
+    u8 packet[PARAM_PACKET_MAX + 32];
+    int value_len = (int)strlen(value);
+    int padded = (value_len + 4) & ~3;
+    if (t->addr_len + 4 + padded > (int)sizeof(packet)) return -1;
+    
+    memset(packet, 0, sizeof(packet));
+    int pos = param_address(id, (char *)packet);
+    packet[pos++] = ',';
+    packet[pos++] = 's';
+    pos += 2;
+    memcpy(packet + pos, value, value_len);
+    osc_targets_fanout(id, packet, pos + padded);
+    return osc_send(packet, pos + padded);
+}
+
+// Send fader value for a channel
+void osc_send_fader(int channel, float value)
+{
+    // Validate channel
+    if (channel < 0 || channel >= 16) return;
+    
+    // Snap to the console's 1024-step grid
+    osc_send_fader_step(channel, fader_value_to_step(value));
+}
+
+// Send a fader position already on the console's grid
+void osc_send_fader_step(int channel, int step)
+{
+    if (channel < 0 || channel >= 16) return;
+    if (g_options.skip_unchanged && xair_shadow_fader_same(channel, step)) return;
+    
+    // /ch/XX/mix/fader ,f <value>
+    if (osc_send_param(PARAM_ID(PT_CH_MIX_FADER, channel, 0), step) > 0) {
+        xair_shadow_fader_set(channel, step);
+    }
+    LOG_DEBUG("[OSC] CH%02d fader: step %d", channel + 1, step);
+}
+
+// Send mute state for a channel
+void osc_send_mute(int channel, int muted)
+{
+    // Validate channel
+    if (channel < 0 || channel >= 16) return;
+    
+    // /ch/XX/mix/on ,i <value>  (0=muted, 1=unmuted)
+    osc_send_param(PARAM_ID(PT_CH_MIX_ON, channel, 0), muted ? 0 : 1);
+    LOG_DEBUG("[OSC] CH%02d mute: %s", channel + 1, muted ? "ON" : "OFF");
+}
+
+// Send EQ parameter for a channel
+// value is in engineering units (type index, Hz, dB, Q); floats go out on
+// the parameter registry's step grid, the same one go_verify checks against
+void osc_send_eq_param(int channel, int band, XAirEqParam param, float value)
+{
+    static const u8 eq_templates[XAIR_EQ_NUM_PARAMS] = {
+        PT_CH_EQ_TYPE, PT_CH_EQ_F, PT_CH_EQ_G, PT_CH_EQ_Q
+    };
+    
+    // Validate inputs
+    if (channel < 0 || channel >= 16) return;
+    if (band < 0 || band >= 5) return;
+    if (param < 0 || param >= XAIR_EQ_NUM_PARAMS) return;
+    
+    u16 id = PARAM_ID(eq_templates[param], channel, band);
+    int step = (param == XAIR_EQ_TYPE) ? (int)value : param_value_to_step(id, value);
+    if (g_options.skip_unchanged && xair_shadow_eq_same(channel, band, param, step)) return;
+    
+    // /ch/XX/eq/B/param ,i <type> or ,f <0..1>
+    if (osc_send_param(id, step) > 0) {
+        xair_shadow_eq_set(channel, band, param, step);
+    }
+    LOG_DEBUG("[OSC] CH%02d EQ%d %s: %.2f (step %d)", channel + 1, band + 1,
+              xair_eq_param_name(param), value, step);
+}
+
+// Shutdown OSC (called on app exit)
+void osc_shutdown(void)
+{
+    if (g_osc_socket >= 0) {
+        close(g_osc_socket);
+        g_osc_socket = -1;
+        g_osc_connected = 0;
+        LOG_INFO("[OSC] Connection closed");
+    }
+}
+
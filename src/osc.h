@@ -0,0 +1,38 @@
+#ifndef OSC_H
+#define OSC_H
+
+#include <stdint.h>
+#include <netinet/in.h>
+#include "xair_codec.h"
+#include "osc_pacer.h"
+
+// ============================================================================
+// OSC SEND
+// ============================================================================
+// Messages are built from the parameter registry (param.h); the helpers
+// below cover what a step recall sends.
+
+// The console's address (network config) and the send socket
+extern struct sockaddr_in g_mixer_addr;
+extern char g_mixer_host[16];
+extern int g_mixer_port;
+extern int g_osc_connected;
+extern int g_osc_socket;
+
+void osc_init(void);
+void osc_shutdown(void);
+int osc_reconnect(void);            // Fresh socket to g_mixer_host:g_mixer_port
+u32 osc_send_errors(void);          // Socket errors (not full buffers) so far
+void osc_pacing_start(void);        // After load_options()
+void osc_pacing_stop(void);
+OscPacer *osc_pacer(void);          // NULL when pacing is off
+int osc_send(const uint8_t *packet, int packet_size);
+int osc_send_param(u16 id, int step);
+int osc_send_param_string(u16 id, const char *value);
+
+void osc_send_fader(int channel, float value);
+void osc_send_fader_step(int channel, int step);    // Step on the 1024-step taper
+void osc_send_mute(int channel, int muted);
+void osc_send_eq_param(int channel, int band, XAirEqParam param, float value);
+
+#endif
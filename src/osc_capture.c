@@ -0,0 +1,198 @@
+#include "osc_capture.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "log.h"
+#include "mpmc_ring.h"
+
+// ============================================================================
+// RING BUFFER
+// ============================================================================
+// The lock-free ring of mpmc_ring.h, as for the log: the pacer, query,
+// health and control threads all record packets, only the writer thread
+// drains.
+
+typedef struct {
+    u8 flags;
+    u8 len;
+    u64 tick;
+    u8 data[CAPTURE_PACKET_MAX];
+} CaptureRecord;
+
+static CaptureRecord s_records[CAPTURE_RING_SIZE];
+static u32 s_seq[CAPTURE_RING_SIZE];
+static MpmcRing s_ring;
+static volatile int s_active = 0;
+
+static Thread s_thread = NULL;
+static LightEvent s_wake;
+static volatile int s_exit = 0;
+static FILE *s_file = NULL;
+static u64 s_last_tick = 0;
+static volatile u32 s_packets = 0;
+static volatile u32 s_bytes = 0;
+
+void osc_capture_packet(int link, int inbound, const u8 *packet, int len)
+{
+    if (!s_active || len <= 0) return;
+
+    // Ring full: dropped and counted, never block the sender
+    u32 pos;
+    CaptureRecord *r = (CaptureRecord *)mpmc_ring_claim(&s_ring, &pos);
+    if (!r) return;
+
+    r->tick = svcGetSystemTick();
+    r->flags = (u8)(((link & CAPTURE_LINK_MASK) << CAPTURE_LINK_SHIFT) | (inbound ? CAPTURE_FLAG_INBOUND : 0));
+    if (len > CAPTURE_PACKET_MAX) {
+        len = CAPTURE_PACKET_MAX;
+        r->flags |= CAPTURE_FLAG_TRUNCATED;
+    }
+    r->len = (u8)len;
+    memcpy(r->data, packet, len);
+
+    // Wake the writer early once the ring is half full (a GO fills it fast)
+    if (mpmc_ring_publish(&s_ring, pos) && s_thread) {
+        LightEvent_Signal(&s_wake);
+    }
+}
+
+// ============================================================================
+// WRITER THREAD
+// ============================================================================
+
+static int put_varint(u8 *out, u64 v)
+{
+    int n = 0;
+    do {
+        u8 b = (u8)(v & 0x7F);
+        v >>= 7;
+        out[n++] = v ? (u8)(b | 0x80) : b;
+    } while (v);
+    return n;
+}
+
+static void put_le(u8 *out, u64 v, int bytes)
+{
+    for (int i = 0; i < bytes; i++) {
+        out[i] = (u8)(v >> (8 * i));
+    }
+}
+
+static void capture_drain(void)
+{
+    int wrote = 0;
+
+    CaptureRecord *r;
+    while ((r = (CaptureRecord *)mpmc_ring_peek(&s_ring)) != NULL) {
+        if (s_file) {
+            u8 head[1 + 10 + 2];
+            u64 delta = (r->tick > s_last_tick) ? r->tick - s_last_tick : 0;
+            if (r->tick > s_last_tick) s_last_tick = r->tick;
+            int n = 0;
+            head[n++] = r->flags;
+            n += put_varint(head + n, delta);
+            n += put_varint(head + n, r->len);
+            fwrite(head, 1, n, s_file);
+            fwrite(r->data, 1, r->len, s_file);
+            s_packets++;
+            s_bytes += (u32)(n + r->len);
+            wrote = 1;
+        }
+        mpmc_ring_release(&s_ring);
+    }
+
+    if (s_file && wrote) fflush(s_file);
+}
+
+static void capture_thread_main(void *arg)
+{
+    (void)arg;
+
+    while (!s_exit) {
+        LightEvent_WaitTimeout(&s_wake, (s64)CAPTURE_FLUSH_MS * 1000000LL);
+        capture_drain();
+    }
+    capture_drain();
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void osc_capture_start(void)
+{
+    if (s_active) return;
+
+    mpmc_ring_init(&s_ring, s_seq, s_records, CAPTURE_RING_SIZE, sizeof(CaptureRecord));
+    s_packets = 0;
+
+    mkdir(PLATFORM_DATA_DIR, 0777);
+    remove(CAPTURE_PREV_PATH);
+    rename(CAPTURE_PATH, CAPTURE_PREV_PATH);
+    s_file = fopen(CAPTURE_PATH, "wb");
+    if (!s_file) {
+        LOG_WARN("[CAPTURE] Cannot create %s", CAPTURE_PATH);
+        return;
+    }
+    static char io_buf[16 * 1024];
+    setvbuf(s_file, io_buf, _IOFBF, sizeof(io_buf));
+
+    u8 header[CAPTURE_HEADER_SIZE];
+    memset(header, 0, sizeof(header));
+    memcpy(header, CAPTURE_MAGIC, 4);
+    header[4] = CAPTURE_VERSION;
+    put_le(header + 8, SYSCLOCK_ARM11, 4);
+    s_last_tick = svcGetSystemTick();
+    put_le(header + 12, s_last_tick, 8);
+    fwrite(header, 1, sizeof(header), s_file);
+    s_bytes = sizeof(header);
+
+    LightEvent_Init(&s_wake, RESET_ONESHOT);
+    s_exit = 0;
+
+    // Below the main thread, like the log flusher: the SD card waits for idle time
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    s_thread = threadCreate(capture_thread_main, NULL, 8 * 1024, prio + 1, -2, false);
+    if (!s_thread) {
+        LOG_WARN("[CAPTURE] Writer thread not started, capture off");
+        fclose(s_file);
+        s_file = NULL;
+        return;
+    }
+
+    s_active = 1;
+    LOG_INFO("[CAPTURE] Recording OSC to %s", CAPTURE_PATH);
+}
+
+void osc_capture_stop(void)
+{
+    if (!s_active) return;
+    s_active = 0;
+
+    s_exit = 1;
+    LightEvent_Signal(&s_wake);
+    threadJoin(s_thread, U64_MAX);
+    threadFree(s_thread);
+    s_thread = NULL;
+
+    fclose(s_file);
+    s_file = NULL;
+
+    LOG_INFO("[CAPTURE] %lu packets, %lu bytes, %lu dropped", (unsigned long)s_packets,
+             (unsigned long)s_bytes, (unsigned long)mpmc_ring_dropped(&s_ring));
+}
+
+int osc_capture_active(void)
+{
+    return s_active;
+}
+
+void osc_capture_stats(CaptureStats *out)
+{
+    out->packets = s_packets;
+    out->bytes = s_bytes;
+    out->dropped = mpmc_ring_dropped(&s_ring);
+}
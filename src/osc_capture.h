@@ -0,0 +1,61 @@
+#ifndef OSC_CAPTURE_H
+#define OSC_CAPTURE_H
+
+#include "platform.h"
+
+// ============================================================================
+// OSC SESSION CAPTURE
+// ============================================================================
+// With [OSC_CAPTURE] enabled=1 in Options, every OSC packet the app sends or
+// receives on the mixer link, the fan-out targets and the control port is
+// recorded with its tick into CAPTURE_PATH. The previous session's file is
+// kept as CAPTURE_PREV_PATH. Mixer discovery scans are not recorded.
+//
+// Callers only copy the packet into a lock-free ring (same scheme as log.c);
+// a low priority thread writes it out, so capturing is safe on the GO path.
+// When the ring is full packets are dropped and counted.
+//
+// File layout, all little-endian:
+//
+//   header   "X18C" u8 version, u8 reserved[3], u32 ticks/s, u64 first tick
+//   record   u8 flags, varint tick delta, varint length, packet bytes
+//
+// flags: bit 0 = inbound, bits 1-3 = link (CAPTURE_LINK_*), bit 7 = the
+// packet was cut to CAPTURE_PACKET_MAX. Varints are LEB128 (7 bits per byte,
+// low first). Deltas are from the previous record; records from different
+// threads can be a few ticks out of order, which is written as delta 0.
+//
+// host/x18replay.c summarises and replays capture files.
+
+#define CAPTURE_PATH            PLATFORM_DATA_DIR "/capture.x18c"
+#define CAPTURE_PREV_PATH       PLATFORM_DATA_DIR "/capture.prev.x18c"
+#define CAPTURE_MAGIC           "X18C"
+#define CAPTURE_VERSION         1
+#define CAPTURE_HEADER_SIZE     20
+
+#define CAPTURE_RING_SIZE       1024    // Packets, must be a power of two
+#define CAPTURE_PACKET_MAX      192     // Longer packets are truncated
+#define CAPTURE_FLUSH_MS        500
+
+#define CAPTURE_FLAG_INBOUND    0x01
+#define CAPTURE_FLAG_TRUNCATED  0x80
+#define CAPTURE_LINK_SHIFT      1
+#define CAPTURE_LINK_MASK       0x07
+
+// Links: the mixer, fan-out targets 1..OSC_MAX_TARGETS-1, the control port
+#define CAPTURE_LINK_MIXER      0
+#define CAPTURE_LINK_CONTROL    7
+
+typedef struct {
+    u32 packets;            // Written to the file
+    u32 bytes;              // File size
+    u32 dropped;            // Ring full
+} CaptureStats;
+
+void osc_capture_start(void);       // Rotate the files and start recording
+void osc_capture_stop(void);        // Write what is queued and close the file
+int osc_capture_active(void);
+void osc_capture_packet(int link, int inbound, const u8 *packet, int len);
+void osc_capture_stats(CaptureStats *out);
+
+#endif
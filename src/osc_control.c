@@ -0,0 +1,282 @@
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "log.h"
+#include "show.h"
+#include "cue_engine.h"
+#include "osc_capture.h"
+#include "osc_control.h"
+
+#define CONTROL_PACKET_MAX  256
+#define CONTROL_POLL_MS     100     // Exit flag latency
+
+static int s_socket = -1;
+static Thread s_thread = NULL;
+static volatile int s_exit = 0;
+
+// ============================================================================
+// OSC MESSAGE PARSING / BUILDING
+// ============================================================================
+
+typedef struct {
+    const char *addr;
+    const char *tags;       // After the ','
+    const u8 *args;
+    int args_len;
+} OscMessage;
+
+static u32 get_be32(const u8 *p)
+{
+    return ((u32)p[0] << 24) | ((u32)p[1] << 16) | ((u32)p[2] << 8) | p[3];
+}
+
+static void put_be32(u8 *p, u32 v)
+{
+    p[0] = (v >> 24) & 0xFF;
+    p[1] = (v >> 16) & 0xFF;
+    p[2] = (v >> 8) & 0xFF;
+    p[3] = v & 0xFF;
+}
+
+// Length of a NUL-terminated string padded to 4, or 0 if it overruns
+static int padded_len(const u8 *p, int len)
+{
+    int n = 0;
+    while (n < len && p[n] != 0) n++;
+    if (n >= len) return 0;
+    n = (n + 4) & ~3;
+    return (n <= len) ? n : 0;
+}
+
+static int osc_parse(const u8 *buf, int len, OscMessage *msg)
+{
+    int pos = padded_len(buf, len);
+    if (pos == 0 || buf[0] != '/') return 0;
+    msg->addr = (const char *)buf;
+
+    // Messages without a type tag string carry no arguments
+    if (pos >= len || buf[pos] != ',') {
+        msg->tags = "";
+        msg->args = buf + pos;
+        msg->args_len = 0;
+        return 1;
+    }
+
+    int tag_len = padded_len(buf + pos, len - pos);
+    if (tag_len == 0) return 0;
+    msg->tags = (const char *)buf + pos + 1;
+    msg->args = buf + pos + tag_len;
+    msg->args_len = len - pos - tag_len;
+    return 1;
+}
+
+// Numeric argument `index` as a float ('i' or 'f'); 0 if missing
+static int osc_arg_number(const OscMessage *msg, int index, float *out)
+{
+    int offset = 0;
+    for (int i = 0; msg->tags[i]; i++) {
+        char t = msg->tags[i];
+        if (t != 'i' && t != 'f') return 0;     // Only fixed-size args here
+        if (offset + 4 > msg->args_len) return 0;
+        if (i == index) {
+            u32 raw = get_be32(msg->args + offset);
+            if (t == 'i') {
+                *out = (float)(s32)raw;
+            } else {
+                memcpy(out, &raw, sizeof(*out));
+            }
+            return 1;
+        }
+        offset += 4;
+    }
+    return 0;
+}
+
+static int put_string(u8 *buf, int pos, int max, const char *s)
+{
+    int n = (int)strlen(s) + 1;
+    int padded = (n + 3) & ~3;
+    if (pos + padded > max) return -1;
+    memset(buf + pos, 0, padded);
+    memcpy(buf + pos, s, n);
+    return pos + padded;
+}
+
+// ============================================================================
+// COMMANDS
+// ============================================================================
+
+static void send_reply(const u8 *packet, int len, const struct sockaddr_in *to)
+{
+    if (len > 0) {
+        sendto(s_socket, packet, len, 0, (const struct sockaddr *)to, sizeof(*to));
+        osc_capture_packet(CAPTURE_LINK_CONTROL, 0, packet, len);
+    }
+}
+
+static void send_ack(const char *command, int step_idx, u32 handle_us, const struct sockaddr_in *to)
+{
+    u8 packet[64];
+    int pos = put_string(packet, 0, sizeof(packet), "/x18mixer/ack");
+    if (pos > 0) pos = put_string(packet, pos, sizeof(packet), ",sii");
+    if (pos > 0) pos = put_string(packet, pos, sizeof(packet), command);
+    if (pos < 0 || pos + 8 > (int)sizeof(packet)) return;
+    put_be32(packet + pos, (u32)(step_idx + 1));
+    put_be32(packet + pos + 4, handle_us);
+    send_reply(packet, pos + 8, to);
+}
+
+// Echo the arguments back under /x18mixer/pong
+static void send_pong(const OscMessage *msg, const struct sockaddr_in *to)
+{
+    u8 packet[CONTROL_PACKET_MAX];
+    int pos = put_string(packet, 0, sizeof(packet), "/x18mixer/pong");
+    if (pos < 0) return;
+
+    // A cut type-tag string would no longer describe the echoed arguments
+    char tags[CONTROL_PACKET_MAX];
+    int tags_len = snprintf(tags, sizeof(tags), ",%s", msg->tags);
+    if (tags_len < 0 || tags_len >= (int)sizeof(tags)) return;
+    pos = put_string(packet, pos, sizeof(packet), tags);
+    if (pos < 0 || pos + msg->args_len > (int)sizeof(packet)) return;
+
+    memcpy(packet + pos, msg->args, msg->args_len);
+    send_reply(packet, pos + msg->args_len, to);
+}
+
+static void handle_message(const OscMessage *msg, u64 rx_tick, const struct sockaddr_in *from)
+{
+    const char *prefix = "/x18mixer/";
+    if (strncmp(msg->addr, prefix, strlen(prefix)) != 0) return;
+    const char *command = msg->addr + strlen(prefix);
+
+    if (strcmp(command, "ping") == 0) {
+        send_pong(msg, from);
+        return;
+    }
+
+    int step = -1;
+    float value;
+
+    // The cue engine re-checks the step under the show lock: a show with
+    // fewer steps may have been loaded since, and then nothing fired
+    if (strcmp(command, "go") == 0) {
+        step = cue_standby();
+        if (!cue_go(step)) step = -1;
+    } else if (strcmp(command, "back") == 0) {
+        int last = cue_last_fired();
+        if (last > 0) {
+            step = last - 1;
+            if (!cue_go(step)) step = -1;
+        }
+    } else if (strcmp(command, "goto") == 0) {
+        if (osc_arg_number(msg, 0, &value) && value >= 1.0f && value <= g_current_show.num_steps) {
+            step = (int)value - 1;
+            if (!cue_go(step)) step = -1;
+        }
+    } else if (strcmp(command, "fade") == 0) {
+        if (osc_arg_number(msg, 0, &value) && value >= 0.0f && value <= 3600.0f) {
+            float n;
+            if (!osc_arg_number(msg, 1, &n)) {
+                step = cue_standby();
+            } else if (n >= 1.0f && n <= g_current_show.num_steps) {
+                step = (int)n - 1;
+            }
+            if (step >= 0 && !cue_go_fade(step, (u32)(value * 1000.0f + 0.5f))) step = -1;
+        }
+    } else {
+        LOG_DEBUG("[CONTROL] Unknown command %s", msg->addr);
+        return;
+    }
+
+    u32 handle_us = (u32)((svcGetSystemTick() - rx_tick) / CPU_TICKS_PER_USEC);
+    char from_ip[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &from->sin_addr, from_ip, sizeof(from_ip));
+    LOG_INFO("[CONTROL] %s from %s -> step %d (%lu us)", command, from_ip, step + 1, (unsigned long)handle_us);
+    send_ack(command, step, handle_us, from);
+}
+
+// ============================================================================
+// RECEIVE THREAD
+// ============================================================================
+
+static void control_thread_main(void *arg)
+{
+    (void)arg;
+    u8 buf[CONTROL_PACKET_MAX];
+
+    while (!s_exit) {
+        struct pollfd pfd = { s_socket, POLLIN, 0 };
+        if (poll(&pfd, 1, CONTROL_POLL_MS) <= 0 || !(pfd.revents & POLLIN)) continue;
+
+        struct sockaddr_in from;
+        socklen_t from_len = sizeof(from);
+        int len = recvfrom(s_socket, buf, sizeof(buf), 0, (struct sockaddr *)&from, &from_len);
+        if (len <= 0) continue;
+        osc_capture_packet(CAPTURE_LINK_CONTROL, 1, buf, len);
+
+        u64 rx_tick = svcGetSystemTick();
+        OscMessage msg;
+        if (osc_parse(buf, len, &msg)) {
+            handle_message(&msg, rx_tick, &from);
+        }
+    }
+}
+
+void osc_control_init(int port)
+{
+    if (port <= 0 || port > 65535) {
+        LOG_INFO("[CONTROL] Control port disabled");
+        return;
+    }
+
+    s_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s_socket < 0) {
+        LOG_ERROR("[CONTROL] Failed to create socket");
+        return;
+    }
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(s_socket, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        LOG_ERROR("[CONTROL] Cannot bind port %d", port);
+        close(s_socket);
+        s_socket = -1;
+        return;
+    }
+
+    // Same priority as the cue engine: above the main loop
+    s_exit = 0;
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    s_thread = threadCreate(control_thread_main, NULL, 8 * 1024, prio - 1, -2, false);
+    if (!s_thread) {
+        LOG_ERROR("[CONTROL] Receive thread not started");
+        close(s_socket);
+        s_socket = -1;
+        return;
+    }
+    LOG_INFO("[CONTROL] Listening on UDP port %d", port);
+}
+
+void osc_control_shutdown(void)
+{
+    if (s_thread) {
+        s_exit = 1;
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    }
+    if (s_socket >= 0) {
+        close(s_socket);
+        s_socket = -1;
+    }
+}
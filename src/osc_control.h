@@ -0,0 +1,29 @@
+#ifndef OSC_CONTROL_H
+#define OSC_CONTROL_H
+
+// ============================================================================
+// INBOUND OSC CONTROL PORT
+// ============================================================================
+// A show-control machine can trigger cues over UDP (port from the
+// [OSC_CONTROL] section of /3ds/x18mixer/Options; 0, the default, = off,
+// since any sender that reaches the port can fire cues):
+//
+//   /x18mixer/go                    fire the standby step
+//   /x18mixer/back                  fire the step before the last fired one
+//   /x18mixer/goto  ,i <n>          fire step n (1-based)
+//   /x18mixer/fade  ,f <s> [,i <n>] fire the standby step (or step n) with
+//                                   every fader fading over s seconds
+//   /x18mixer/ping  <any args>      replied at once as /x18mixer/pong with
+//                                   the same arguments (round-trip timing)
+//
+// Every trigger is answered with /x18mixer/ack ,sii <command> <step> <us>:
+// the step fired (1-based, 0 if none) and the time from receive to the
+// step being sent, in microseconds.
+//
+// Commands are handled on a receive thread that calls the cue engine
+// directly, so a trigger never waits for the next frame.
+
+void osc_control_init(int port);
+void osc_control_shutdown(void);
+
+#endif
@@ -0,0 +1,295 @@
+#include <string.h>
+#include <stdlib.h>
+
+#include "log.h"
+#include "param.h"
+#include "osc_pacer.h"
+
+#define TOKEN_UNIT          1000000ULL      // One packet, in rate * us
+#define PACE_RATE_FLOOR     100             // Adaptive pacing never goes below this
+#define PACE_IDLE_WAIT_MS   100             // Exit flag latency while idle
+
+typedef struct {
+    u16 id;
+    u8 len;
+    u8 data[PARAM_PACKET_MAX];
+} PacedPacket;
+
+typedef struct {
+    PacedPacket items[PACE_QUEUE_LEN];
+    int head;
+    int count;
+} PaceQueue;
+
+struct OscPacer {
+    OscPacerConfig config;
+    OscPacerSendFn send;
+    void *ctx;
+
+    PaceQueue queues[PACE_NUM_CLASSES];
+    LightLock lock;             // Guards everything below
+    u64 tokens;                 // TOKEN_UNIT per packet
+    u64 last_tick;
+    u32 rate;                   // Current rate (adapted)
+    int sending;                // A packet is between dequeue and sendto
+    OscPacerStats stats;
+
+    Thread thread;
+    LightEvent wake;
+    volatile int exit;
+};
+
+// ============================================================================
+// CLASSES AND QUEUES
+// ============================================================================
+
+PaceClass osc_pacer_class(u16 id)
+{
+    const ParamTemplate *t = param_template(id);
+    if (!t) return PACE_OTHER;
+
+    switch (PARAM_TEMPLATE(id)) {
+    case PT_CH_MIX_ON:
+    case PT_BUS_MIX_ON:
+    case PT_LR_MIX_ON:
+    case PT_DCA_ON:
+    case PT_CONFIG_MUTE:
+        return PACE_CRITICAL;
+    case PT_CH_MIX_FADER:
+    case PT_BUS_MIX_FADER:
+    case PT_LR_MIX_FADER:
+    case PT_DCA_FADER:
+        return PACE_FADER;
+    default:
+        break;
+    }
+    if (t->group == PARAM_GROUP_ACTION || t->group == PARAM_GROUP_SNAPSHOT) return PACE_CRITICAL;
+    if (t->group == PARAM_GROUP_EQ) return PACE_EQ;
+    return PACE_OTHER;
+}
+
+static u32 total_queued(const OscPacer *p)
+{
+    u32 n = 0;
+    for (int c = 0; c < PACE_NUM_CLASSES; c++) n += p->queues[c].count;
+    return n;
+}
+
+// Lock held
+static void refill(OscPacer *p, u64 now)
+{
+    u64 elapsed_us = (u64)((now - p->last_tick) / CPU_TICKS_PER_USEC);
+    if (elapsed_us == 0) return;
+    p->last_tick = now;
+
+    u64 cap = (u64)p->config.burst * TOKEN_UNIT;
+    p->tokens += elapsed_us * p->rate;
+    if (p->tokens > cap) p->tokens = cap;
+}
+
+// ============================================================================
+// PACER THREAD
+// ============================================================================
+
+static void pacer_thread_main(void *arg)
+{
+    OscPacer *p = (OscPacer *)arg;
+    PacedPacket packet;
+
+    while (!p->exit) {
+        LightLock_Lock(&p->lock);
+        refill(p, svcGetSystemTick());
+
+        PaceQueue *q = NULL;
+        for (int c = 0; c < PACE_NUM_CLASSES; c++) {
+            if (p->queues[c].count) {
+                q = &p->queues[c];
+                break;
+            }
+        }
+        if (!q) {
+            LightLock_Unlock(&p->lock);
+            LightEvent_WaitTimeout(&p->wake, (s64)PACE_IDLE_WAIT_MS * 1000000LL);
+            continue;
+        }
+        if (p->tokens < TOKEN_UNIT) {
+            // Sleep until the next token
+            u64 wait_us = (TOKEN_UNIT - p->tokens + p->rate - 1) / p->rate;
+            LightLock_Unlock(&p->lock);
+            svcSleepThread((s64)wait_us * 1000LL);
+            continue;
+        }
+
+        packet = q->items[q->head];
+        q->head = (q->head + 1) % PACE_QUEUE_LEN;
+        q->count--;
+        p->tokens -= TOKEN_UNIT;
+        p->sending = 1;
+        LightLock_Unlock(&p->lock);
+
+        p->send(p->ctx, packet.data, packet.len);
+
+        LightLock_Lock(&p->lock);
+        p->sending = 0;
+        p->stats.sent++;
+        LightLock_Unlock(&p->lock);
+    }
+
+    // Nothing queued is dropped on the way out
+    for (int c = 0; c < PACE_NUM_CLASSES; c++) {
+        PaceQueue *q = &p->queues[c];
+        while (q->count) {
+            p->send(p->ctx, q->items[q->head].data, q->items[q->head].len);
+            q->head = (q->head + 1) % PACE_QUEUE_LEN;
+            q->count--;
+        }
+    }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+OscPacer *osc_pacer_create(const OscPacerConfig *config, OscPacerSendFn send, void *ctx)
+{
+    if (config->rate == 0) return NULL;
+
+    OscPacer *p = (OscPacer *)calloc(1, sizeof(OscPacer));
+    if (!p) {
+        LOG_ERROR("[PACER] Out of memory");
+        return NULL;
+    }
+    p->config = *config;
+    if (p->config.burst == 0) p->config.burst = 1;
+    p->send = send;
+    p->ctx = ctx;
+    p->rate = config->rate;
+    p->tokens = (u64)p->config.burst * TOKEN_UNIT;
+    p->last_tick = svcGetSystemTick();
+    LightLock_Init(&p->lock);
+    LightEvent_Init(&p->wake, RESET_ONESHOT);
+
+    // Same priority as the cue engine: paced sends must keep up with fades
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    p->thread = threadCreate(pacer_thread_main, p, 8 * 1024, prio - 1, -2, false);
+    if (!p->thread) {
+        LOG_ERROR("[PACER] Pacer thread not started, sending unpaced");
+        free(p);
+        return NULL;
+    }
+    LOG_INFO("[PACER] %lu packets/s, burst %lu%s", (unsigned long)p->rate,
+             (unsigned long)p->config.burst, p->config.adaptive ? ", adaptive" : "");
+    return p;
+}
+
+void osc_pacer_destroy(OscPacer *p)
+{
+    if (!p) return;
+    p->exit = 1;
+    LightEvent_Signal(&p->wake);
+    threadJoin(p->thread, U64_MAX);
+    threadFree(p->thread);
+    free(p);
+}
+
+int osc_pacer_enqueue(OscPacer *p, u16 id, const u8 *packet, int len)
+{
+    if (!p || len <= 0 || len > PARAM_PACKET_MAX) return 0;
+
+    PaceQueue *q = &p->queues[osc_pacer_class(id)];
+    LightLock_Lock(&p->lock);
+
+    // Still waiting: the console only needs the latest value
+    for (int i = 0; i < q->count; i++) {
+        PacedPacket *item = &q->items[(q->head + i) % PACE_QUEUE_LEN];
+        if (item->id == id) {
+            memcpy(item->data, packet, len);
+            item->len = (u8)len;
+            p->stats.coalesced++;
+            LightLock_Unlock(&p->lock);
+            return 1;
+        }
+    }
+
+    if (q->count == PACE_QUEUE_LEN) {
+        p->stats.overflow++;
+        LightLock_Unlock(&p->lock);
+        return 0;
+    }
+
+    PacedPacket *item = &q->items[(q->head + q->count) % PACE_QUEUE_LEN];
+    item->id = id;
+    item->len = (u8)len;
+    memcpy(item->data, packet, len);
+    q->count++;
+    LightLock_Unlock(&p->lock);
+
+    LightEvent_Signal(&p->wake);
+    return 1;
+}
+
+int osc_pacer_flush(OscPacer *p, u32 timeout_ms)
+{
+    if (!p) return 1;
+
+    u64 deadline = svcGetSystemTick() + (u64)(timeout_ms * CPU_TICKS_PER_MSEC);
+    for (;;) {
+        LightLock_Lock(&p->lock);
+        int idle = total_queued(p) == 0 && !p->sending;
+        LightLock_Unlock(&p->lock);
+        if (idle) return 1;
+        if (svcGetSystemTick() >= deadline) return 0;
+        svcSleepThread(2000000LL);
+    }
+}
+
+u32 osc_pacer_clear(OscPacer *p)
+{
+    if (!p) return 0;
+
+    LightLock_Lock(&p->lock);
+    u32 n = total_queued(p);
+    for (int c = 0; c < PACE_NUM_CLASSES; c++) {
+        p->queues[c].head = 0;
+        p->queues[c].count = 0;
+    }
+    p->stats.cleared += n;
+    LightLock_Unlock(&p->lock);
+    return n;
+}
+
+void osc_pacer_report_loss(OscPacer *p, u32 checked, u32 lost)
+{
+    if (!p || !p->config.adaptive || checked == 0) return;
+
+    LightLock_Lock(&p->lock);
+    u32 old_rate = p->rate;
+    u32 floor = (p->config.rate < PACE_RATE_FLOOR) ? p->config.rate : PACE_RATE_FLOOR;
+    if (lost) {
+        p->rate -= p->rate / 4;
+        if (p->rate < floor) p->rate = floor;
+    } else {
+        p->rate += p->config.rate / 20 + 1;
+        if (p->rate > p->config.rate) p->rate = p->config.rate;
+    }
+    u32 new_rate = p->rate;
+    LightLock_Unlock(&p->lock);
+
+    if (new_rate != old_rate) {
+        LOG_INFO("[PACER] %lu/%lu lost: rate %lu -> %lu packets/s", (unsigned long)lost,
+                 (unsigned long)checked, (unsigned long)old_rate, (unsigned long)new_rate);
+    }
+}
+
+void osc_pacer_stats(OscPacer *p, OscPacerStats *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (!p) return;
+
+    LightLock_Lock(&p->lock);
+    *out = p->stats;
+    out->rate = p->rate;
+    out->queued = total_queued(p);
+    LightLock_Unlock(&p->lock);
+}
@@ -0,0 +1,73 @@
+#ifndef OSC_PACER_H
+#define OSC_PACER_H
+
+#include "platform.h"
+
+// ============================================================================
+// OSC PACER
+// ============================================================================
+// The X18's UDP input and consumer access points drop packets when a step
+// recall sends 100+ datagrams back to back. Registry sends go through a
+// token bucket instead: up to `burst` packets leave at once, then `rate`
+// packets per second. A pacer thread drains four priority classes in
+// order, so the messages that matter most in a cue change land first:
+//
+//   PACE_CRITICAL   mutes, snapshot loads and other actions
+//   PACE_FADER      faders (fade ticks included)
+//   PACE_EQ         EQ on / bands
+//   PACE_OTHER      everything else
+//
+// A parameter already waiting in the queue is updated in place rather than
+// queued twice, so the console only ever gets its latest value.
+//
+// Classes reorder sends, so a snapshot load (PACE_CRITICAL) would overtake
+// older fader or EQ packets, which would then land on top of the recalled
+// scene. Whoever loads a snapshot calls osc_pacer_clear() first.
+//
+// Adaptive pacing: GO verification (go_verify.h) reports how many sent
+// values it found wrong. Loss cuts the rate by a quarter, and a clean check
+// raises it again by 1/20 of the configured rate (never above it).
+
+typedef enum {
+    PACE_CRITICAL,
+    PACE_FADER,
+    PACE_EQ,
+    PACE_OTHER,
+    PACE_NUM_CLASSES
+} PaceClass;
+
+#define PACE_QUEUE_LEN      512     // Per class; a full class sends directly
+
+typedef struct {
+    u32 rate;               // Packets per second (0 = pacing off)
+    u32 burst;              // Bucket size, packets
+    int adaptive;           // Follow the loss seen by GO verification
+} OscPacerConfig;
+
+typedef struct {
+    u32 rate;               // Current (adapted) rate
+    u32 queued;
+    u32 sent;
+    u32 coalesced;          // Updates merged into a queued packet
+    u32 overflow;           // Sent unpaced because a class was full
+    u32 cleared;            // Dropped by osc_pacer_clear()
+} OscPacerStats;
+
+typedef int (*OscPacerSendFn)(void *ctx, const u8 *packet, int len);
+typedef struct OscPacer OscPacer;
+
+OscPacer *osc_pacer_create(const OscPacerConfig *config, OscPacerSendFn send, void *ctx);
+void osc_pacer_destroy(OscPacer *pacer);    // Queued packets are sent first
+
+PaceClass osc_pacer_class(u16 id);
+// 1 if queued (or merged); 0 means the caller must send it itself
+int osc_pacer_enqueue(OscPacer *pacer, u16 id, const u8 *packet, int len);
+// Wait until everything queued so far has been sent; 0 on timeout
+int osc_pacer_flush(OscPacer *pacer, u32 timeout_ms);
+// Drop everything still queued (superseded by a snapshot load); returns how many
+u32 osc_pacer_clear(OscPacer *pacer);
+
+void osc_pacer_report_loss(OscPacer *pacer, u32 checked, u32 lost);
+void osc_pacer_stats(OscPacer *pacer, OscPacerStats *out);
+
+#endif
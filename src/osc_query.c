@@ -0,0 +1,329 @@
+#include <string.h>
+#include <stdio.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "log.h"
+#include "param.h"
+#include "osc.h"
+#include "osc_query.h"
+#include "osc_capture.h"
+
+#define QUERY_ADDR_MAX      64
+#define QUERY_POLL_MS       100     // Exit flag / socket change latency
+
+typedef struct {
+    char addr[QUERY_ADDR_MAX];
+    u8 reply[OSC_REPLY_MAX];
+    int len;                // 0 until the reply arrived
+    u64 reply_tick;         // When the receive thread read it
+    int used;
+    LightEvent done;
+    LightEvent *notify;     // Also signalled on reply (batch queries)
+} QuerySlot;
+
+static QuerySlot s_slots[OSC_QUERY_SLOTS];
+static LightLock s_lock;
+static Thread s_thread = NULL;
+static volatile int s_exit = 0;
+
+// ============================================================================
+// RECEIVE THREAD
+// ============================================================================
+
+// Hand a packet to every query waiting for its address
+static void dispatch_reply(const u8 *packet, int len, u64 tick)
+{
+    int addr_len = 0;
+    while (addr_len < len && packet[addr_len] != 0) addr_len++;
+    if (addr_len >= len || addr_len >= QUERY_ADDR_MAX) return;
+
+    int copy = (len < OSC_REPLY_MAX) ? len : OSC_REPLY_MAX;
+    LightLock_Lock(&s_lock);
+    for (int i = 0; i < OSC_QUERY_SLOTS; i++) {
+        QuerySlot *slot = &s_slots[i];
+        if (!slot->used || slot->len != 0) continue;
+        if (strcmp(slot->addr, (const char *)packet) != 0) continue;
+        memcpy(slot->reply, packet, copy);
+        slot->len = copy;
+        slot->reply_tick = tick;
+        LightEvent_Signal(&slot->done);
+        if (slot->notify) LightEvent_Signal(slot->notify);
+    }
+    LightLock_Unlock(&s_lock);
+}
+
+static void query_thread_main(void *arg)
+{
+    (void)arg;
+    u8 buf[512];
+
+    while (!s_exit) {
+        // The socket can be closed and re-created under us; re-read it
+        int sock = g_osc_socket;
+        if (sock < 0) {
+            svcSleepThread((s64)QUERY_POLL_MS * 1000000LL);
+            continue;
+        }
+
+        struct pollfd pfd = { sock, POLLIN, 0 };
+        if (poll(&pfd, 1, QUERY_POLL_MS) <= 0 || !(pfd.revents & POLLIN)) continue;
+
+        int len = recvfrom(sock, buf, sizeof(buf), 0, NULL, NULL);
+        if (len <= 0) continue;
+        u64 tick = svcGetSystemTick();
+        osc_capture_packet(CAPTURE_LINK_MIXER, 1, buf, len);
+        dispatch_reply(buf, len, tick);
+    }
+}
+
+void osc_query_init(void)
+{
+    LightLock_Init(&s_lock);
+    for (int i = 0; i < OSC_QUERY_SLOTS; i++) {
+        s_slots[i].used = 0;
+        LightEvent_Init(&s_slots[i].done, RESET_ONESHOT);
+    }
+
+    s_exit = 0;
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    s_thread = threadCreate(query_thread_main, NULL, 8 * 1024, prio - 1, -2, false);
+    if (!s_thread) {
+        LOG_ERROR("[QUERY] Receive thread not started, console replies are ignored");
+    }
+}
+
+void osc_query_shutdown(void)
+{
+    if (s_thread) {
+        s_exit = 1;
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    }
+}
+
+// ============================================================================
+// QUERIES
+// ============================================================================
+
+// Claim a slot before sending so a fast reply cannot be missed
+static QuerySlot *slot_claim(const char *addr, LightEvent *notify)
+{
+    QuerySlot *slot = NULL;
+    LightLock_Lock(&s_lock);
+    for (int i = 0; i < OSC_QUERY_SLOTS; i++) {
+        if (!s_slots[i].used) {
+            slot = &s_slots[i];
+            snprintf(slot->addr, sizeof(slot->addr), "%s", addr);
+            slot->len = 0;
+            slot->used = 1;
+            slot->notify = notify;
+            LightEvent_Clear(&slot->done);
+            break;
+        }
+    }
+    LightLock_Unlock(&s_lock);
+    return slot;
+}
+
+// Copy out the reply (if any) and its receive tick, and free the slot
+static int slot_release(QuerySlot *slot, u8 *reply, int reply_max, u64 *out_tick)
+{
+    int got = 0;
+    LightLock_Lock(&s_lock);
+    if (slot->len > 0 && reply) {
+        got = (slot->len < reply_max) ? slot->len : reply_max;
+        memcpy(reply, slot->reply, got);
+        if (out_tick) *out_tick = slot->reply_tick;
+    }
+    slot->used = 0;
+    LightLock_Unlock(&s_lock);
+    return got;
+}
+
+static int slot_answered(QuerySlot *slot)
+{
+    LightLock_Lock(&s_lock);
+    int answered = slot->len > 0;
+    LightLock_Unlock(&s_lock);
+    return answered;
+}
+
+// Address only, NUL-padded to 4: the console reads it as a query
+static int send_query(const char *addr)
+{
+    u8 packet[QUERY_ADDR_MAX];
+    int addr_len = (int)strlen(addr);
+    int packet_len = (addr_len + 4) & ~3;
+    memset(packet, 0, packet_len);
+    memcpy(packet, addr, addr_len);
+    return osc_send(packet, packet_len) > 0;
+}
+
+int osc_query(const char *addr, u8 *reply, int reply_max, u32 timeout_ms)
+{
+    return osc_query_timed(addr, reply, reply_max, timeout_ms, NULL);
+}
+
+int osc_query_timed(const char *addr, u8 *reply, int reply_max, u32 timeout_ms, u32 *out_rtt_us)
+{
+    int addr_len = (int)strlen(addr);
+    if (!s_thread || addr_len == 0 || addr_len >= QUERY_ADDR_MAX) return 0;
+
+    QuerySlot *slot = slot_claim(addr, NULL);
+    if (!slot) {
+        LOG_WARN("[QUERY] All %d query slots busy, %s not sent", OSC_QUERY_SLOTS, addr);
+        return 0;
+    }
+
+    u64 sent = svcGetSystemTick();
+    if (send_query(addr)) {
+        LightEvent_WaitTimeout(&slot->done, (s64)timeout_ms * 1000000LL);
+    }
+    u64 received = sent;
+    int got = slot_release(slot, reply, reply_max, &received);
+    if (out_rtt_us) *out_rtt_us = (u32)((received - sent) / CPU_TICKS_PER_USEC);
+    return got;
+}
+
+int osc_query_param(u16 id, int *out_step, u32 timeout_ms)
+{
+    char addr[QUERY_ADDR_MAX];
+    if (param_address(id, addr) == 0) return 0;
+
+    u8 reply[OSC_REPLY_MAX];
+    int len = osc_query(addr, reply, sizeof(reply), timeout_ms);
+    u16 reply_id;
+    int step;
+    if (len == 0 || !param_decode(reply, len, &reply_id, &step) || reply_id != id) return 0;
+
+    *out_step = step;
+    return 1;
+}
+
+int osc_query_param_string(u16 id, char *out, int out_max, u32 timeout_ms)
+{
+    char addr[QUERY_ADDR_MAX];
+    int addr_len = param_address(id, addr);
+    if (addr_len == 0 || out_max <= 0) return 0;
+
+    u8 reply[OSC_REPLY_MAX];
+    int len = osc_query(addr, reply, sizeof(reply), timeout_ms);
+
+    // <address> ",s\0\0" <string, NUL-padded>
+    int pos = addr_len;
+    if (len < pos + 8 || reply[pos] != ',' || reply[pos + 1] != 's') return 0;
+    pos += 4;
+
+    int n = 0;
+    while (pos + n < len && reply[pos + n] != 0 && n < out_max - 1) {
+        out[n] = (char)reply[pos + n];
+        n++;
+    }
+    out[n] = '\0';
+    return 1;
+}
+
+// ============================================================================
+// BATCH QUERIES
+// ============================================================================
+
+typedef struct {
+    QuerySlot *slot;
+    int index;              // Into ids
+    u64 deadline;           // System tick
+    int tries;
+} InFlight;
+
+int osc_query_params(const u16 *ids, int count, int *out_steps, int window,
+                     u32 timeout_ms, int retries, OscQueryStats *stats)
+{
+    OscQueryStats st;
+    memset(&st, 0, sizeof(st));
+    u64 start = svcGetSystemTick();
+    for (int i = 0; i < count; i++) out_steps[i] = -1;
+
+    if (window > OSC_QUERY_BATCH_MAX) window = OSC_QUERY_BATCH_MAX;
+    if (window < 1) window = 1;
+
+    LightEvent notify;
+    LightEvent_Init(&notify, RESET_ONESHOT);
+    InFlight inflight[OSC_QUERY_BATCH_MAX];
+    int n_inflight = 0;
+    int next = 0;
+    u64 timeout_ticks = (u64)(timeout_ms * CPU_TICKS_PER_MSEC);
+
+    while (s_thread && (next < count || n_inflight > 0)) {
+        // Top up the window
+        while (n_inflight < window && next < count) {
+            char addr[QUERY_ADDR_MAX];
+            if (param_address(ids[next], addr) == 0) {
+                next++;
+                continue;
+            }
+            QuerySlot *slot = slot_claim(addr, &notify);
+            if (!slot) break;   // Single queries hold the rest; retry once ours free up
+            send_query(addr);
+            st.sent++;
+            inflight[n_inflight].slot = slot;
+            inflight[n_inflight].index = next;
+            inflight[n_inflight].deadline = svcGetSystemTick() + timeout_ticks;
+            inflight[n_inflight].tries = 0;
+            n_inflight++;
+            next++;
+        }
+        if (n_inflight == 0) {
+            svcSleepThread(1000000LL);
+            continue;
+        }
+
+        // Sleep until a reply or the earliest deadline
+        u64 now = svcGetSystemTick();
+        u64 earliest = inflight[0].deadline;
+        for (int k = 1; k < n_inflight; k++) {
+            if (inflight[k].deadline < earliest) earliest = inflight[k].deadline;
+        }
+        if (earliest > now) {
+            LightEvent_WaitTimeout(&notify, (s64)((earliest - now) / CPU_TICKS_PER_USEC) * 1000LL);
+        }
+
+        // Collect replies, resend or give up on the overdue
+        now = svcGetSystemTick();
+        for (int k = 0; k < n_inflight; ) {
+            InFlight *q = &inflight[k];
+            if (slot_answered(q->slot)) {
+                u8 reply[OSC_REPLY_MAX];
+                int len = slot_release(q->slot, reply, sizeof(reply), NULL);
+                u16 id;
+                int step;
+                if (param_decode(reply, len, &id, &step) && id == ids[q->index]) {
+                    out_steps[q->index] = step;
+                    st.answered++;
+                }
+                inflight[k] = inflight[--n_inflight];
+                continue;
+            }
+            if (now >= q->deadline) {
+                if (q->tries < retries) {
+                    q->tries++;
+                    st.retries++;
+                    st.sent++;
+                    send_query(q->slot->addr);
+                    q->deadline = now + timeout_ticks;
+                } else {
+                    slot_release(q->slot, NULL, 0, NULL);
+                    inflight[k] = inflight[--n_inflight];
+                    continue;
+                }
+            }
+            k++;
+        }
+    }
+
+    st.elapsed_us = (u32)((svcGetSystemTick() - start) / CPU_TICKS_PER_USEC);
+    if (stats) *stats = st;
+    return st.answered;
+}
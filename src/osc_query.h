@@ -0,0 +1,47 @@
+#ifndef OSC_QUERY_H
+#define OSC_QUERY_H
+
+#include "platform.h"
+
+// ============================================================================
+// OSC QUERIES (receive path)
+// ============================================================================
+// The console answers a message without arguments with the parameter's
+// current value, sent back to the port the query came from. osc_init()
+// binds the send socket, and a receive thread matches each incoming packet
+// to the queries waiting for that address. Queries can be issued from any
+// thread. At most OSC_QUERY_SLOTS can wait at once; more are refused.
+
+#define OSC_QUERY_SLOTS     32
+#define OSC_QUERY_BATCH_MAX 24      // Largest batch window, leaves room for single queries
+#define OSC_REPLY_MAX       128
+
+void osc_query_init(void);
+void osc_query_shutdown(void);
+
+// Send addr (NUL-terminated, unpadded) as a query and wait for the reply.
+// Returns the reply length copied to reply, 0 on timeout.
+int osc_query(const char *addr, u8 *reply, int reply_max, u32 timeout_ms);
+// Same, and the round trip from the send to the receive thread reading the
+// reply, so the caller's own scheduling does not count (0 on timeout)
+int osc_query_timed(const char *addr, u8 *reply, int reply_max, u32 timeout_ms, u32 *out_rtt_us);
+
+// Registry parameters (param.h): 1 and the console's value, or 0
+int osc_query_param(u16 id, int *out_step, u32 timeout_ms);
+int osc_query_param_string(u16 id, char *out, int out_max, u32 timeout_ms);
+
+typedef struct {
+    u16 sent;               // Queries sent, resends included
+    u16 answered;
+    u16 retries;
+    u32 elapsed_us;
+} OscQueryStats;
+
+// Pipelined queries of many registry parameters: up to `window` in flight,
+// each unanswered one resent up to `retries` times after timeout_ms.
+// out_steps[i] gets the console's step for ids[i], or -1. Returns the number
+// answered.
+int osc_query_params(const u16 *ids, int count, int *out_steps, int window,
+                     u32 timeout_ms, int retries, OscQueryStats *stats);
+
+#endif
@@ -0,0 +1,193 @@
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "log.h"
+#include "param.h"
+#include "osc.h"
+#include "osc_targets.h"
+#include "osc_capture.h"
+
+// Without pacing configured, extra targets still get a queue of their own
+#define TARGET_UNPACED_RATE     100000
+#define TARGET_UNPACED_BURST    PACE_QUEUE_LEN
+
+typedef struct {
+    char host[16];
+    u16 port;
+    int socket;
+    struct sockaddr_in addr;
+    OscPacer *pacer;
+    volatile u32 sent;
+    volatile u32 dropped;
+    volatile u32 errors;
+} OscTarget;
+
+// Index 0 is unused: target 0 is the mixer address in osc.c
+static OscTarget s_targets[OSC_MAX_TARGETS];
+static volatile int s_count = 1;
+
+// ============================================================================
+// TARGETS
+// ============================================================================
+
+// Pacer thread of the target
+static int target_send(void *ctx, const u8 *packet, int len)
+{
+    OscTarget *t = (OscTarget *)ctx;
+    int n = sendto(t->socket, packet, len, 0, (struct sockaddr *)&t->addr, sizeof(t->addr));
+    if (n < 0) {
+        t->errors++;
+    } else {
+        t->sent++;
+        osc_capture_packet((int)(t - s_targets), 0, packet, n);
+    }
+    return n;
+}
+
+// "ip" or "ip:port"
+static int target_open(OscTarget *t, const char *spec)
+{
+    memset(t, 0, sizeof(*t));
+    t->socket = -1;
+    t->port = 10023;
+
+    char host[24];
+    snprintf(host, sizeof(host), "%s", spec);
+    char *colon = strchr(host, ':');
+    if (colon) {
+        *colon = '\0';
+        int port = atoi(colon + 1);
+        if (port <= 0 || port > 65535) return 0;
+        t->port = (u16)port;
+    }
+
+    t->addr.sin_family = AF_INET;
+    t->addr.sin_port = htons(t->port);
+    if (strlen(host) >= sizeof(t->host) || inet_pton(AF_INET, host, &t->addr.sin_addr) <= 0) return 0;
+    snprintf(t->host, sizeof(t->host), "%s", host);
+
+    t->socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (t->socket < 0) return 0;
+
+    // Never let a target with full buffers stall its thread
+    fcntl(t->socket, F_SETFL, fcntl(t->socket, F_GETFL, 0) | O_NONBLOCK);
+
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    bind(t->socket, (struct sockaddr *)&local, sizeof(local));
+
+    // Same bucket as the mixer, but no adaptation: nothing verifies these targets
+    OscPacerConfig config = { (u32)g_options.pace_rate, (u32)g_options.pace_burst, 0 };
+    if (config.rate == 0) {
+        config.rate = TARGET_UNPACED_RATE;
+        config.burst = TARGET_UNPACED_BURST;
+    }
+    t->pacer = osc_pacer_create(&config, target_send, t);
+    if (!t->pacer) {
+        close(t->socket);
+        t->socket = -1;
+        return 0;
+    }
+    return 1;
+}
+
+static void target_close(OscTarget *t)
+{
+    osc_pacer_destroy(t->pacer);
+    t->pacer = NULL;
+    if (t->socket >= 0) close(t->socket);
+    t->socket = -1;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void osc_targets_start(void)
+{
+    int n = 1;
+    for (int i = 0; i < OPTIONS_MAX_TARGETS; i++) {
+        const char *spec = g_options.targets[i];
+        if (spec[0] == '\0') continue;
+        if (!target_open(&s_targets[n], spec)) {
+            LOG_WARN("[TARGETS] Cannot send to '%s'", spec);
+            continue;
+        }
+        LOG_INFO("[TARGETS] Target %d: %s:%u", n, s_targets[n].host, s_targets[n].port);
+        n++;
+    }
+
+    // Published last: the fan-out and the health thread only look at [1, count)
+    s_count = n;
+}
+
+void osc_targets_stop(void)
+{
+    int n = s_count;
+    s_count = 1;
+    for (int i = 1; i < n; i++) {
+        target_close(&s_targets[i]);
+    }
+}
+
+int osc_target_count(void)
+{
+    return s_count;
+}
+
+void osc_targets_fanout(u16 id, const u8 *packet, int len)
+{
+    int n = s_count;
+    for (int i = 1; i < n; i++) {
+        // Too long for a queue slot (long strings): the socket does not block
+        if (len > PARAM_PACKET_MAX) target_send(&s_targets[i], packet, len);
+        // Full queue: drop rather than send from the caller's thread
+        else if (!osc_pacer_enqueue(s_targets[i].pacer, id, packet, len)) s_targets[i].dropped++;
+    }
+}
+
+void osc_targets_clear(void)
+{
+    int n = s_count;
+    for (int i = 1; i < n; i++) {
+        osc_pacer_clear(s_targets[i].pacer);
+    }
+}
+
+int osc_target_send(int target, const u8 *packet, int len)
+{
+    if (target < 1 || target >= s_count) return -1;
+    return target_send(&s_targets[target], packet, len);
+}
+
+int osc_target_socket(int target)
+{
+    if (target < 1 || target >= s_count) return -1;
+    return s_targets[target].socket;
+}
+
+void osc_target_stats(int target, OscTargetStats *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (target == 0) {
+        snprintf(out->host, sizeof(out->host), "%s", g_mixer_host);
+        out->port = (u16)g_mixer_port;
+        return;
+    }
+    if (target < 1 || target >= s_count) return;
+
+    const OscTarget *t = &s_targets[target];
+    snprintf(out->host, sizeof(out->host), "%s", t->host);
+    out->port = t->port;
+    out->sent = t->sent;
+    out->dropped = t->dropped;
+    out->errors = t->errors;
+}
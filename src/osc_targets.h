@@ -0,0 +1,49 @@
+#ifndef OSC_TARGETS_H
+#define OSC_TARGETS_H
+
+#include "platform.h"
+#include "options.h"
+
+// ============================================================================
+// OSC FAN-OUT TARGETS
+// ============================================================================
+// Besides the mixer address (target 0: g_mixer_host, paced by osc_pacer()),
+// up to OPTIONS_MAX_TARGETS more consoles get every registry send: a backup
+// console, a second X18 for monitors. [OSC_TARGETS] in the options file:
+//
+//   target1=192.168.1.51
+//   target2=192.168.1.52:10023
+//
+// Each extra target has its own socket, pacer queue and thread, and its own
+// link health (link_health.h). osc_send_param() encodes a packet once and
+// hands the same buffer to every target's queue. Sending happens on the
+// target's pacer thread, so a slow or dead target only fills its own queue
+// (and drops from it) without delaying the mixer or the other targets.
+//
+// Queries, GO verification and snapshot upload checks talk to target 0 only.
+
+#define OSC_MAX_TARGETS     (1 + OPTIONS_MAX_TARGETS)
+
+typedef struct {
+    char host[16];
+    u16 port;
+    u32 sent;
+    u32 dropped;            // Queue full: the target fell too far behind
+    u32 errors;             // sendto() failures
+} OscTargetStats;
+
+void osc_targets_start(void);       // After load_options(), with the pacer
+void osc_targets_stop(void);
+int osc_target_count(void);         // Including target 0, so at least 1
+
+// Queue an encoded registry packet for every extra target
+void osc_targets_fanout(u16 id, const u8 *packet, int len);
+// Drop what the extra targets still have queued (before a snapshot load)
+void osc_targets_clear(void);
+
+// Extra targets (1..count-1): unpaced send and the socket replies arrive on
+int osc_target_send(int target, const u8 *packet, int len);
+int osc_target_socket(int target);
+void osc_target_stats(int target, OscTargetStats *out);
+
+#endif
@@ -0,0 +1,337 @@
+#include "param.h"
+#include "fader_taper.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// IDS AND ADDRESSES
+// ============================================================================
+
+int param_id_valid(u16 id)
+{
+    const ParamTemplate *t = param_template(id);
+    if (!t) return 0;
+    if (PARAM_INDEX_A(id) >= t->field_count[0]) return 0;
+    if (PARAM_INDEX_B(id) >= t->field_count[1]) return 0;
+    return 1;
+}
+
+int param_step_valid(u16 id, int step)
+{
+    const ParamTemplate *t = param_template(id);
+    return t && t->steps > 0 && step >= 0 && step < t->steps;
+}
+
+static void patch_index(char *addr, int pos, int width, int index)
+{
+    int n = index + 1;      // Console addresses are 1-based
+    if (width == 2) {
+        addr[pos] = (char)('0' + n / 10);
+        addr[pos + 1] = (char)('0' + n % 10);
+    } else if (width == 1) {
+        addr[pos] = (char)('0' + n);
+    }
+}
+
+int param_address(u16 id, char *out)
+{
+    if (!param_id_valid(id)) return 0;
+
+    const ParamTemplate *t = &g_param_templates[PARAM_TEMPLATE(id)];
+    memcpy(out, t->addr, t->addr_len);
+    patch_index(out, t->field_pos[0], t->field_width[0], PARAM_INDEX_A(id));
+    patch_index(out, t->field_pos[1], t->field_width[1], PARAM_INDEX_B(id));
+    return t->addr_len;
+}
+
+int param_channel(u16 id)
+{
+    const ParamTemplate *t = param_template(id);
+    if (!t || t->field_width[0] == 0 || memcmp(t->addr, "/ch/", 4) != 0) return -1;
+    return PARAM_INDEX_A(id);
+}
+
+u16 param_find(const char *addr)
+{
+    // Hash the address with every digit run collapsed to '#' (as the
+    // generator did) and pick up the numbers on the way
+    u32 hash = 0x811C9DC5u;
+    int nums[2] = {0, 0};
+    int num_count = 0;
+    int len = 0;
+
+    for (const char *p = addr; *p; ) {
+        if (*p >= '0' && *p <= '9') {
+            int n = 0;
+            while (*p >= '0' && *p <= '9') {
+                n = n * 10 + (*p - '0');
+                p++;
+                len++;
+            }
+            if (num_count < 2) nums[num_count] = n;
+            num_count++;
+            hash = (hash ^ (u8)'#') * 0x01000193u;
+        } else {
+            hash = (hash ^ (u8)*p) * 0x01000193u;
+            p++;
+            len++;
+        }
+    }
+
+    // First entry with this hash
+    int lo = 0, hi = PARAM_LOOKUP_SIZE;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (g_param_lookup[mid].hash < hash) lo = mid + 1;
+        else hi = mid;
+    }
+
+    // Entries sharing the hash (e.g. /config/chlink/1-2, 3-4...) are told
+    // apart by the full address
+    for (int i = lo; i < PARAM_LOOKUP_SIZE && g_param_lookup[i].hash == hash; i++) {
+        u16 tmpl = g_param_lookup[i].tmpl;
+        const ParamTemplate *t = &g_param_templates[tmpl];
+        int a = (t->field_width[0] && nums[0] > 0) ? nums[0] - 1 : 0;
+        int b = (t->field_width[1] && nums[1] > 0) ? nums[1] - 1 : 0;
+        if (a > 15 || b > 15) continue;
+
+        u16 id = PARAM_ID(tmpl, a, b);
+        char buf[PARAM_PACKET_MAX];
+        int n = param_address(id, buf);
+        if (n > len && memcmp(buf, addr, len + 1) == 0) return id;
+    }
+    return PARAM_ID_INVALID;
+}
+
+// ============================================================================
+// VALUE LAWS
+// ============================================================================
+
+int param_value_to_step(u16 id, float value)
+{
+    const ParamTemplate *t = param_template(id);
+    if (!t || t->steps == 0) return 0;
+
+    float pos;
+    switch (t->law) {
+        case PARAM_LAW_INT:
+            pos = value - t->min;
+            break;
+        case PARAM_LAW_LIN:
+            pos = (value - t->min) / (t->max - t->min) * (t->steps - 1);
+            break;
+        case PARAM_LAW_LOG:
+            if (!(value > 0.0f)) return 0;
+            pos = logf(value / t->min) / logf(t->max / t->min) * (t->steps - 1);
+            break;
+        case PARAM_LAW_FADER:
+            return fader_db_to_step(value);
+        default:
+            return 0;
+    }
+
+    if (!(pos > 0.0f)) return 0;
+    int step = (int)(pos + 0.5f);
+    return (step >= t->steps) ? t->steps - 1 : step;
+}
+
+float param_step_to_value(u16 id, int step)
+{
+    const ParamTemplate *t = param_template(id);
+    if (!t || t->steps == 0) return 0.0f;
+    if (step < 0) step = 0;
+    if (step >= t->steps) step = t->steps - 1;
+
+    float norm = (t->steps > 1) ? (float)step / (t->steps - 1) : 0.0f;
+    switch (t->law) {
+        case PARAM_LAW_INT:   return t->min + step;
+        case PARAM_LAW_LIN:   return t->min + norm * (t->max - t->min);
+        case PARAM_LAW_LOG:   return t->min * powf(t->max / t->min, norm);
+        case PARAM_LAW_FADER: return fader_step_to_db(step);
+        default:              return 0.0f;
+    }
+}
+
+float param_step_to_norm(u16 id, int step)
+{
+    const ParamTemplate *t = param_template(id);
+    if (!t || t->steps < 2 || step <= 0) return 0.0f;
+    if (step >= t->steps - 1) return 1.0f;
+    return (float)step / (t->steps - 1);
+}
+
+int param_norm_to_step(u16 id, float norm)
+{
+    const ParamTemplate *t = param_template(id);
+    if (!t || t->steps < 2 || !(norm > 0.0f)) return 0;
+    if (norm >= 1.0f) return t->steps - 1;
+    return (int)(norm * (t->steps - 1) + 0.5f);
+}
+
+// ============================================================================
+// OSC ENCODE / DECODE
+// ============================================================================
+
+static void put_be32(u8 *p, u32 v)
+{
+    p[0] = (v >> 24) & 0xFF;
+    p[1] = (v >> 16) & 0xFF;
+    p[2] = (v >> 8) & 0xFF;
+    p[3] = v & 0xFF;
+}
+
+static u32 get_be32(const u8 *p)
+{
+    return ((u32)p[0] << 24) | ((u32)p[1] << 16) | ((u32)p[2] << 8) | p[3];
+}
+
+int param_encode(u16 id, int step, u8 *packet, int max_len)
+{
+    const ParamTemplate *t = param_template(id);
+    if (!t || t->type == 's' || !param_step_valid(id, step)) return 0;
+    if (t->addr_len + 8 > max_len) return 0;
+
+    int pos = param_address(id, (char *)packet);
+    if (pos == 0) return 0;
+
+    // Type tag
+    packet[pos++] = ',';
+    packet[pos++] = (u8)t->type;
+    packet[pos++] = 0;
+    packet[pos++] = 0;
+
+    // Value (big-endian)
+    if (t->type == 'i') {
+        put_be32(&packet[pos], (u32)(s32)(t->min + step));
+    } else {
+        float norm = param_step_to_norm(id, step);
+        u32 bits;
+        memcpy(&bits, &norm, sizeof(bits));
+        put_be32(&packet[pos], bits);
+    }
+    return pos + 4;
+}
+
+int param_decode(const u8 *packet, int len, u16 *out_id, int *out_step)
+{
+    // Address: NUL-terminated, padded to 4
+    int addr_end = 0;
+    while (addr_end < len && packet[addr_end] != 0) addr_end++;
+    if (addr_end >= len) return 0;
+    int pos = (addr_end + 4) & ~3;
+    if (pos + 8 > len || packet[pos] != ',') return 0;
+
+    char tag = (char)packet[pos + 1];
+    pos += 4;   // ",x\0\0"
+
+    u16 id = param_find((const char *)packet);
+    const ParamTemplate *t = (id != PARAM_ID_INVALID) ? param_template(id) : NULL;
+    if (!t || t->type != tag) return 0;
+
+    u32 raw = get_be32(&packet[pos]);
+    int step;
+    if (tag == 'i') {
+        step = (int)(s32)raw - (int)t->min;
+    } else if (tag == 'f') {
+        float norm;
+        memcpy(&norm, &raw, sizeof(norm));
+        step = param_norm_to_step(id, norm);
+    } else {
+        return 0;
+    }
+    if (!param_step_valid(id, step)) return 0;
+
+    *out_id = id;
+    *out_step = step;
+    return 1;
+}
+
+// ============================================================================
+// SPARSE PARAMETER LISTS
+// ============================================================================
+
+#define PARAM_LIST_MIN_CAPACITY 8
+
+void param_list_free(ParamList *list)
+{
+    free(list->items);
+    list->items = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
+
+// Index of the first entry with id >= the given one
+static int param_list_lower_bound(const ParamList *list, u16 id)
+{
+    int lo = 0, hi = list->count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (list->items[mid].id < id) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static int param_list_reserve(ParamList *list, int capacity)
+{
+    if (capacity <= list->capacity) return 1;
+    if (capacity > 0xFFFF) return 0;
+
+    int new_cap = list->capacity ? list->capacity * 2 : PARAM_LIST_MIN_CAPACITY;
+    if (new_cap < capacity) new_cap = capacity;
+    if (new_cap > 0xFFFF) new_cap = 0xFFFF;
+
+    ParamEntry *items = (ParamEntry *)realloc(list->items, new_cap * sizeof(ParamEntry));
+    if (!items) return 0;
+    list->items = items;
+    list->capacity = (u16)new_cap;
+    return 1;
+}
+
+int param_list_set(ParamList *list, u16 id, u16 step)
+{
+    // Files and captures are written in id order: appending is the common case
+    int pos = (list->count && list->items[list->count - 1].id < id)
+            ? list->count : param_list_lower_bound(list, id);
+
+    if (pos < list->count && list->items[pos].id == id) {
+        list->items[pos].step = step;
+        return 1;
+    }
+
+    if (!param_list_reserve(list, list->count + 1)) return 0;
+    memmove(&list->items[pos + 1], &list->items[pos], (list->count - pos) * sizeof(ParamEntry));
+    list->items[pos].id = id;
+    list->items[pos].step = step;
+    list->count++;
+    return 1;
+}
+
+int param_list_get(const ParamList *list, u16 id)
+{
+    int pos = param_list_lower_bound(list, id);
+    return (pos < list->count && list->items[pos].id == id) ? list->items[pos].step : -1;
+}
+
+int param_list_remove(ParamList *list, u16 id)
+{
+    int pos = param_list_lower_bound(list, id);
+    if (pos >= list->count || list->items[pos].id != id) return 0;
+
+    memmove(&list->items[pos], &list->items[pos + 1], (list->count - pos - 1) * sizeof(ParamEntry));
+    list->count--;
+    return 1;
+}
+
+int param_list_copy(ParamList *dst, const ParamList *src)
+{
+    param_list_free(dst);
+    if (src->count == 0) return 1;
+    if (!param_list_reserve(dst, src->count)) return 0;
+
+    memcpy(dst->items, src->items, src->count * sizeof(ParamEntry));
+    dst->count = src->count;
+    return 1;
+}
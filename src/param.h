@@ -0,0 +1,122 @@
+#ifndef PARAM_H
+#define PARAM_H
+
+#include "platform.h"
+#include "param_table.h"
+
+// ============================================================================
+// PARAMETER REGISTRY
+// ============================================================================
+// Every console parameter the app knows about is an instance of a template
+// in g_param_templates (generated from docs/X18_OSC_Commands.json by
+// gen_param_table.py). A parameter ID packs the template and up to two
+// zero-based indices (channel, send bus, EQ band...):
+//
+//   id = template << 8 | index_a << 4 | index_b
+//
+// Values are handled as step indices on the console's grid: 'i' parameters
+// are min + step, 'f' parameters are sent as step / (steps - 1).
+
+#define PARAM_ID(tmpl, a, b)    ((u16)(((tmpl) << 8) | ((a) << 4) | (b)))
+#define PARAM_TEMPLATE(id)      ((id) >> 8)
+#define PARAM_INDEX_A(id)       (((id) >> 4) & 0x0F)
+#define PARAM_INDEX_B(id)       ((id) & 0x0F)
+#define PARAM_ID_INVALID        0xFFFF
+
+#define PARAM_PACKET_MAX        40      // Longest address + type tag + value
+
+typedef enum {
+    PARAM_LAW_NONE,         // String, no value grid
+    PARAM_LAW_INT,          // min + step
+    PARAM_LAW_LIN,          // Linear min..max
+    PARAM_LAW_LOG,          // Logarithmic min..max
+    PARAM_LAW_FADER         // X18 fader taper (fader_taper.h)
+} ParamLaw;
+
+typedef enum {
+    PARAM_GROUP_ACTION,
+    PARAM_GROUP_CHANNEL,
+    PARAM_GROUP_EQ,
+    PARAM_GROUP_GATE,
+    PARAM_GROUP_DYN,
+    PARAM_GROUP_BUS,
+    PARAM_GROUP_MAIN,
+    PARAM_GROUP_DCA,
+    PARAM_GROUP_HEADAMP,
+    PARAM_GROUP_CONFIG,
+    PARAM_GROUP_SNAPSHOT,
+    PARAM_GROUP_STATUS,
+    PARAM_NUM_GROUPS
+} ParamGroup;
+
+typedef struct {
+    const char *addr;       // Address of instance 0, NUL-padded to addr_len
+    u8 addr_len;            // Multiple of 4
+    u8 field_pos[2];        // Offsets of the index digits in addr
+    u8 field_width[2];      // 0 = no such index, else 1 or 2 digits
+    u8 field_count[2];      // Number of instances of each index
+    char type;              // OSC type tag: 'i', 'f' or 's'
+    u8 law;                 // ParamLaw
+    u8 group;               // ParamGroup
+    u16 steps;              // Grid size (0 for strings)
+    u16 def_step;
+    float min, max;         // Engineering values at step 0 and steps - 1
+    const char *label;      // Catalogue description
+} ParamTemplate;
+
+typedef struct {
+    u32 hash;               // FNV-1a of the address with digit runs as '#'
+    u16 tmpl;
+} ParamLookup;
+
+extern const ParamTemplate g_param_templates[PT_COUNT];
+extern const ParamLookup g_param_lookup[PARAM_LOOKUP_SIZE];
+
+static inline const ParamTemplate *param_template(u16 id)
+{
+    return (PARAM_TEMPLATE(id) < PT_COUNT) ? &g_param_templates[PARAM_TEMPLATE(id)] : NULL;
+}
+
+int param_id_valid(u16 id);
+int param_step_valid(u16 id, int step);
+int param_address(u16 id, char *out);               // Padded address, returns its length
+u16 param_find(const char *addr);                   // Address -> id (PARAM_ID_INVALID if unknown)
+int param_channel(u16 id);                          // Input channel (0-15) of a /ch/ param, else -1
+
+int param_value_to_step(u16 id, float value);       // Engineering value -> nearest step
+float param_step_to_value(u16 id, int step);
+float param_step_to_norm(u16 id, int step);
+int param_norm_to_step(u16 id, float norm);
+
+// OSC message for id = step; returns its length (0 for strings/invalid)
+int param_encode(u16 id, int step, u8 *packet, int max_len);
+// Parse an OSC message for a known 'i' or 'f' parameter
+int param_decode(const u8 *packet, int len, u16 *out_id, int *out_step);
+
+// ============================================================================
+// SPARSE PARAMETER LISTS
+// ============================================================================
+// A step stores the parameters outside its fixed fields (faders, mutes, EQ)
+// as (id, step) pairs sorted by id, so memory and file size grow only with
+// what the cue actually holds and a recall is one linear walk. The items
+// array is heap-allocated: a zeroed ParamList is empty, and copies must go
+// through param_list_copy().
+
+typedef struct {
+    u16 id;
+    u16 step;
+} ParamEntry;
+
+typedef struct {
+    ParamEntry *items;
+    u16 count;
+    u16 capacity;
+} ParamList;
+
+void param_list_free(ParamList *list);
+int param_list_set(ParamList *list, u16 id, u16 step);     // Insert or replace, 0 if out of memory
+int param_list_get(const ParamList *list, u16 id);          // Step, or -1 if not stored
+int param_list_remove(ParamList *list, u16 id);             // 1 if it was stored
+int param_list_copy(ParamList *dst, const ParamList *src);  // dst is freed first
+
+#endif
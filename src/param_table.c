@@ -0,0 +1,529 @@
+// Generated by gen_param_table.py from docs/X18_OSC_Commands.json - do not edit
+
+#include "param.h"
+
+const ParamTemplate g_param_templates[PT_COUNT] = {
+    [PT_ACTION_CLEARSOLO] = {
+        "/-action/clearsolo""\0", 20,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_ACTION, 1, 0,
+        1.0f, 1.0f,
+        "Clear all solos"
+    },
+    [PT_ACTION_INITALL] = {
+        "/-action/initall""\0""\0""\0", 20,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_ACTION, 1, 0,
+        1.0f, 1.0f,
+        "Initialize console"
+    },
+    [PT_ACTION_SAVESTATE] = {
+        "/-action/savestate""\0", 20,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_ACTION, 1, 0,
+        1.0f, 1.0f,
+        "Save console current state"
+    },
+    [PT_ACTION_SETCLOCK] = {
+        "/-action/setclock""\0""\0", 20,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        's', PARAM_LAW_NONE, PARAM_GROUP_ACTION, 0, 0,
+        0.0f, 0.0f,
+        "set clock ('20YYMMDDHHMMSS'), ignored on X18/XR18"
+    },
+    [PT_CH_CONFIG_NAME] = {
+        "/ch/01/config/name""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        's', PARAM_LAW_NONE, PARAM_GROUP_CHANNEL, 0, 0,
+        0.0f, 0.0f,
+        "Channel scribble strip name"
+    },
+    [PT_CH_CONFIG_COLOR] = {
+        "/ch/01/config/color", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CHANNEL, 16, 0,
+        0.0f, 15.0f,
+        "Channel scribble trip color"
+    },
+    [PT_CH_CONFIG_INSRC] = {
+        "/ch/01/config/insrc", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CHANNEL, 16, 0,
+        0.0f, 15.0f,
+        "Channel input source"
+    },
+    [PT_CH_MIX_FADER] = {
+        "/ch/01/mix/fader""\0""\0""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_FADER, PARAM_GROUP_CHANNEL, 1024, 0,
+        -90.0f, 10.0f,
+        "Channel fader level"
+    },
+    [PT_CH_MIX_ON] = {
+        "/ch/01/mix/on""\0""\0", 16,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CHANNEL, 2, 0,
+        0.0f, 1.0f,
+        "Channel mute"
+    },
+    [PT_CH_MIX_PAN] = {
+        "/ch/01/mix/pan""\0", 16,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_CHANNEL, 101, 50,
+        -100.0f, 100.0f,
+        "Channel pan value"
+    },
+    [PT_CH_MIX_LR] = {
+        "/ch/01/mix/lr""\0""\0", 16,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CHANNEL, 2, 0,
+        0.0f, 1.0f,
+        "Channel LR assignment"
+    },
+    [PT_CH_SEND_LEVEL] = {
+        "/ch/01/mix/01/level", 20,
+        { 4, 11 }, { 2, 2 }, { 16, 10 },
+        'f', PARAM_LAW_FADER, PARAM_GROUP_CHANNEL, 1024, 0,
+        -90.0f, 10.0f,
+        "Channel mixbus sends level"
+    },
+    [PT_CH_SEND_PAN] = {
+        "/ch/01/mix/01/pan""\0""\0", 20,
+        { 4, 11 }, { 2, 2 }, { 16, 10 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_CHANNEL, 101, 50,
+        -100.0f, 100.0f,
+        "Channel mixbus sends pan"
+    },
+    [PT_CH_PREAMP_GAIN] = {
+        "/ch/01/preamp/gain""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_CHANNEL, 145, 24,
+        -12.0f, 60.0f,
+        "Channel preamp gain"
+    },
+    [PT_CH_PREAMP_HPF] = {
+        "/ch/01/preamp/hpf""\0""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LOG, PARAM_GROUP_CHANNEL, 101, 0,
+        20.0f, 200.0f,
+        "Channel low cut frequency (hz)"
+    },
+    [PT_CH_PREAMP_HPON] = {
+        "/ch/01/preamp/hpon""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CHANNEL, 2, 0,
+        0.0f, 1.0f,
+        "Channel low cut off/on"
+    },
+    [PT_CH_EQ_ON] = {
+        "/ch/01/eq/on""\0""\0""\0", 16,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_EQ, 2, 0,
+        0.0f, 1.0f,
+        "Channel EQ Off/On"
+    },
+    [PT_CH_EQ_TYPE] = {
+        "/ch/01/eq/1/type""\0""\0""\0", 20,
+        { 4, 10 }, { 2, 1 }, { 16, 5 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_EQ, 6, 0,
+        0.0f, 5.0f,
+        "Channel EQ band type"
+    },
+    [PT_CH_EQ_F] = {
+        "/ch/01/eq/1/f""\0""\0", 16,
+        { 4, 10 }, { 2, 1 }, { 16, 5 },
+        'f', PARAM_LAW_LOG, PARAM_GROUP_EQ, 201, 113,
+        20.0f, 20000.0f,
+        "Channel EQ band frequency"
+    },
+    [PT_CH_EQ_G] = {
+        "/ch/01/eq/1/g""\0""\0", 16,
+        { 4, 10 }, { 2, 1 }, { 16, 5 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_EQ, 61, 30,
+        -15.0f, 15.0f,
+        "Channel EQ band gain"
+    },
+    [PT_CH_EQ_Q] = {
+        "/ch/01/eq/1/q""\0""\0", 16,
+        { 4, 10 }, { 2, 1 }, { 16, 5 },
+        'f', PARAM_LAW_LOG, PARAM_GROUP_EQ, 72, 33,
+        10.0f, 0.3f,
+        "Channel EQ band Q"
+    },
+    [PT_CH_GATE_ON] = {
+        "/ch/01/gate/on""\0", 16,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_GATE, 2, 0,
+        0.0f, 1.0f,
+        "Channel gate off/on"
+    },
+    [PT_CH_GATE_MODE] = {
+        "/ch/01/gate/mode""\0""\0""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_GATE, 5, 0,
+        0.0f, 4.0f,
+        "Channel gate mode"
+    },
+    [PT_CH_GATE_THR] = {
+        "/ch/01/gate/thr", 16,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_GATE, 161, 0,
+        -80.0f, 0.0f,
+        "Channel gate threshold (db)"
+    },
+    [PT_CH_GATE_RANGE] = {
+        "/ch/01/gate/range""\0""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_GATE, 58, 57,
+        3.0f, 60.0f,
+        "Channel gate range (db)"
+    },
+    [PT_CH_GATE_ATTACK] = {
+        "/ch/01/gate/attack""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_GATE, 121, 10,
+        0.0f, 120.0f,
+        "Channel gate attack (ms)"
+    },
+    [PT_CH_GATE_HOLD] = {
+        "/ch/01/gate/hold""\0""\0""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LOG, PARAM_GROUP_GATE, 101, 60,
+        0.02f, 2000.0f,
+        "Channel gate hold (ms)"
+    },
+    [PT_CH_GATE_RELEASE] = {
+        "/ch/01/gate/release", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LOG, PARAM_GROUP_GATE, 101, 45,
+        5.0f, 4000.0f,
+        "Channel gate release (ms)"
+    },
+    [PT_CH_DYN_ON] = {
+        "/ch/01/dyn/on""\0""\0", 16,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_DYN, 2, 0,
+        0.0f, 1.0f,
+        "Channel compressor off/on"
+    },
+    [PT_CH_DYN_MODE] = {
+        "/ch/01/dyn/mode", 16,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_DYN, 2, 0,
+        0.0f, 1.0f,
+        "Channel compressor mode"
+    },
+    [PT_CH_DYN_THR] = {
+        "/ch/01/dyn/thr""\0", 16,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_DYN, 121, 120,
+        -60.0f, 0.0f,
+        "Channel compressor threshold (db)"
+    },
+    [PT_CH_DYN_RATIO] = {
+        "/ch/01/dyn/ratio""\0""\0""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_DYN, 12, 0,
+        0.0f, 11.0f,
+        "Channel compressor ratio"
+    },
+    [PT_CH_DYN_KNEE] = {
+        "/ch/01/dyn/knee", 16,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_DYN, 6, 0,
+        0.0f, 5.0f,
+        "Channel compressor knee"
+    },
+    [PT_CH_DYN_MGAIN] = {
+        "/ch/01/dyn/mgain""\0""\0""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_DYN, 49, 0,
+        0.0f, 24.0f,
+        "Channel compressor gain (db)"
+    },
+    [PT_CH_DYN_ATTACK] = {
+        "/ch/01/dyn/attack""\0""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_DYN, 121, 10,
+        0.0f, 120.0f,
+        "Channel compressor attack (ms)"
+    },
+    [PT_CH_DYN_HOLD] = {
+        "/ch/01/dyn/hold", 16,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LOG, PARAM_GROUP_DYN, 101, 60,
+        0.02f, 2000.0f,
+        "Channel compressor hold (ms)"
+    },
+    [PT_CH_DYN_RELEASE] = {
+        "/ch/01/dyn/release""\0", 20,
+        { 4, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LOG, PARAM_GROUP_DYN, 101, 45,
+        5.0f, 4000.0f,
+        "Channel compressor release (ms)"
+    },
+    [PT_BUS_CONFIG_NAME] = {
+        "/bus/1/config/name""\0", 20,
+        { 5, 0 }, { 1, 0 }, { 6, 1 },
+        's', PARAM_LAW_NONE, PARAM_GROUP_BUS, 0, 0,
+        0.0f, 0.0f,
+        "Mixbus name"
+    },
+    [PT_BUS_CONFIG_COLOR] = {
+        "/bus/1/config/color", 20,
+        { 5, 0 }, { 1, 0 }, { 6, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_BUS, 16, 0,
+        0.0f, 15.0f,
+        "Mixbus color"
+    },
+    [PT_BUS_MIX_FADER] = {
+        "/bus/1/mix/fader""\0""\0""\0", 20,
+        { 5, 0 }, { 1, 0 }, { 6, 1 },
+        'f', PARAM_LAW_FADER, PARAM_GROUP_BUS, 1024, 0,
+        -90.0f, 10.0f,
+        "Mixbus fader level"
+    },
+    [PT_BUS_MIX_ON] = {
+        "/bus/1/mix/on""\0""\0", 16,
+        { 5, 0 }, { 1, 0 }, { 6, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_BUS, 2, 0,
+        0.0f, 1.0f,
+        "Mixbus mute"
+    },
+    [PT_LR_CONFIG_NAME] = {
+        "/lr/config/name", 16,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        's', PARAM_LAW_NONE, PARAM_GROUP_MAIN, 0, 0,
+        0.0f, 0.0f,
+        "Main LR name"
+    },
+    [PT_LR_MIX_FADER] = {
+        "/lr/mix/fader""\0""\0", 16,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'f', PARAM_LAW_FADER, PARAM_GROUP_MAIN, 1024, 0,
+        -90.0f, 10.0f,
+        "Main LR fader level"
+    },
+    [PT_LR_MIX_ON] = {
+        "/lr/mix/on""\0", 12,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_MAIN, 2, 0,
+        0.0f, 1.0f,
+        "Main LR mute"
+    },
+    [PT_DCA_CONFIG_NAME] = {
+        "/dca/1/config/name""\0", 20,
+        { 5, 0 }, { 1, 0 }, { 4, 1 },
+        's', PARAM_LAW_NONE, PARAM_GROUP_DCA, 0, 0,
+        0.0f, 0.0f,
+        "DCA name"
+    },
+    [PT_DCA_CONFIG_COLOR] = {
+        "/dca/1/config/color", 20,
+        { 5, 0 }, { 1, 0 }, { 4, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_DCA, 16, 0,
+        0.0f, 15.0f,
+        "DCA color"
+    },
+    [PT_DCA_FADER] = {
+        "/dca/1/fader""\0""\0""\0", 16,
+        { 5, 0 }, { 1, 0 }, { 4, 1 },
+        'f', PARAM_LAW_FADER, PARAM_GROUP_DCA, 1024, 0,
+        -90.0f, 10.0f,
+        "DCA fader level"
+    },
+    [PT_DCA_ON] = {
+        "/dca/1/on""\0""\0", 12,
+        { 5, 0 }, { 1, 0 }, { 4, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_DCA, 2, 0,
+        0.0f, 1.0f,
+        "DCA [1..4] Off/On"
+    },
+    [PT_HEADAMP_GAIN] = {
+        "/headamp/01/gain""\0""\0""\0", 20,
+        { 9, 0 }, { 2, 0 }, { 16, 1 },
+        'f', PARAM_LAW_LIN, PARAM_GROUP_HEADAMP, 145, 24,
+        -12.0f, 60.0f,
+        "Headamp gain"
+    },
+    [PT_HEADAMP_PHANTOM] = {
+        "/headamp/01/phantom", 20,
+        { 9, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_HEADAMP, 2, 0,
+        0.0f, 1.0f,
+        "Headamp phantom Off/On"
+    },
+    [PT_CONFIG_CHLINK_1_2] = {
+        "/config/chlink/1-2""\0", 20,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CONFIG, 2, 0,
+        0.0f, 1.0f,
+        "Channel links (odd/even pairs 1-2, 3-4, etc)"
+    },
+    [PT_CONFIG_CHLINK_3_4] = {
+        "/config/chlink/3-4""\0", 20,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CONFIG, 2, 0,
+        0.0f, 1.0f,
+        "Channel links (odd/even pairs 1-2, 3-4, etc)"
+    },
+    [PT_CONFIG_CHLINK_5_6] = {
+        "/config/chlink/5-6""\0", 20,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CONFIG, 2, 0,
+        0.0f, 1.0f,
+        "Channel links (odd/even pairs 1-2, 3-4, etc)"
+    },
+    [PT_CONFIG_CHLINK_7_8] = {
+        "/config/chlink/7-8""\0", 20,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CONFIG, 2, 0,
+        0.0f, 1.0f,
+        "Channel links (odd/even pairs 1-2, 3-4, etc)"
+    },
+    [PT_CONFIG_CHLINK_9_10] = {
+        "/config/chlink/9-10", 20,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CONFIG, 2, 0,
+        0.0f, 1.0f,
+        "Channel links (odd/even pairs 1-2, 3-4, etc)"
+    },
+    [PT_CONFIG_CHLINK_11_12] = {
+        "/config/chlink/11-12""\0""\0""\0", 24,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CONFIG, 2, 0,
+        0.0f, 1.0f,
+        "Channel links (odd/even pairs 1-2, 3-4, etc)"
+    },
+    [PT_CONFIG_CHLINK_13_14] = {
+        "/config/chlink/13-14""\0""\0""\0", 24,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CONFIG, 2, 0,
+        0.0f, 1.0f,
+        "Channel links (odd/even pairs 1-2, 3-4, etc)"
+    },
+    [PT_CONFIG_CHLINK_15_16] = {
+        "/config/chlink/15-16""\0""\0""\0", 24,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CONFIG, 2, 0,
+        0.0f, 1.0f,
+        "Channel links (odd/even pairs 1-2, 3-4, etc)"
+    },
+    [PT_CONFIG_MUTE] = {
+        "/config/mute/1""\0", 16,
+        { 13, 0 }, { 1, 0 }, { 4, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_CONFIG, 2, 0,
+        0.0f, 1.0f,
+        "Mutegroup [1..4] Off/On"
+    },
+    [PT_SNAP_INDEX] = {
+        "/-snap/index""\0""\0""\0", 16,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_SNAPSHOT, 64, 0,
+        1.0f, 64.0f,
+        "Snapshot (current) list index"
+    },
+    [PT_SNAP_LOAD] = {
+        "/-snap/load", 12,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_SNAPSHOT, 64, 0,
+        1.0f, 64.0f,
+        "Snapshot (current) load"
+    },
+    [PT_SNAP_SAVE] = {
+        "/-snap/save", 12,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_SNAPSHOT, 64, 0,
+        1.0f, 64.0f,
+        "Snapshot (current) save"
+    },
+    [PT_SNAP_NAME] = {
+        "/-snap/name", 12,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        's', PARAM_LAW_NONE, PARAM_GROUP_SNAPSHOT, 0, 0,
+        0.0f, 0.0f,
+        "Snapshot (current) name"
+    },
+    [PT_STAT_SOLO] = {
+        "/-stat/solo", 12,
+        { 0, 0 }, { 0, 0 }, { 1, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_STATUS, 2, 0,
+        0.0f, 1.0f,
+        "Solo global status"
+    },
+    [PT_STAT_SOLOSW] = {
+        "/-stat/solosw/01""\0""\0""\0", 20,
+        { 14, 0 }, { 2, 0 }, { 16, 1 },
+        'i', PARAM_LAW_INT, PARAM_GROUP_STATUS, 2, 0,
+        0.0f, 1.0f,
+        "Solo switch [01..20] status"
+    },
+};
+
+const ParamLookup g_param_lookup[PARAM_LOOKUP_SIZE] = {
+    { 0x05E29007u, PT_LR_MIX_ON },
+    { 0x0EAFC49Cu, PT_CH_SEND_PAN },
+    { 0x1819980Fu, PT_SNAP_SAVE },
+    { 0x20860827u, PT_LR_CONFIG_NAME },
+    { 0x2A1066D9u, PT_BUS_MIX_ON },
+    { 0x37B811A8u, PT_CH_PREAMP_HPF },
+    { 0x3D42BAFEu, PT_HEADAMP_GAIN },
+    { 0x3D82DB16u, PT_SNAP_INDEX },
+    { 0x4475B68Du, PT_CH_SEND_LEVEL },
+    { 0x51E35F89u, PT_CH_PREAMP_GAIN },
+    { 0x5269CEA7u, PT_DCA_FADER },
+    { 0x582D83C6u, PT_CONFIG_MUTE },
+    { 0x5BA65822u, PT_HEADAMP_PHANTOM },
+    { 0x5D9D32CAu, PT_ACTION_SAVESTATE },
+    { 0x681C69C9u, PT_CH_DYN_HOLD },
+    { 0x6D0A89DFu, PT_CH_DYN_RATIO },
+    { 0x6DA5F5B2u, PT_CH_CONFIG_COLOR },
+    { 0x745946F2u, PT_CH_EQ_G },
+    { 0x75594885u, PT_CH_EQ_F },
+    { 0x7C7C2243u, PT_DCA_CONFIG_COLOR },
+    { 0x7E5956B0u, PT_CH_EQ_Q },
+    { 0x7EB2B4B7u, PT_CH_PREAMP_HPON },
+    { 0x7F1B8C1Bu, PT_CH_GATE_MODE },
+    { 0x82218074u, PT_DCA_ON },
+    { 0x8665F826u, PT_CH_MIX_ON },
+    { 0x8E9E16D4u, PT_CH_DYN_MGAIN },
+    { 0x946E5CF5u, PT_CH_MIX_LR },
+    { 0x99238898u, PT_CH_CONFIG_NAME },
+    { 0x9A715B29u, PT_CH_EQ_TYPE },
+    { 0x9BF423A7u, PT_STAT_SOLOSW },
+    { 0x9BFAF33Cu, PT_BUS_MIX_FADER },
+    { 0x9CC7162Eu, PT_ACTION_CLEARSOLO },
+    { 0xA493256Au, PT_CH_MIX_PAN },
+    { 0xA4A4FBB7u, PT_DCA_CONFIG_NAME },
+    { 0xA58CC52Du, PT_ACTION_INITALL },
+    { 0xAFA74B25u, PT_CH_MIX_FADER },
+    { 0xBB33A115u, PT_BUS_CONFIG_NAME },
+    { 0xBBDA0657u, PT_CH_DYN_MODE },
+    { 0xBCD76E1Au, PT_SNAP_LOAD },
+    { 0xBDDE5BBAu, PT_CH_EQ_ON },
+    { 0xC636C746u, PT_CH_CONFIG_INSRC },
+    { 0xC6B6ABFEu, PT_LR_MIX_FADER },
+    { 0xC77F89FDu, PT_CH_GATE_RANGE },
+    { 0xC7E2BCE9u, PT_CH_DYN_RELEASE },
+    { 0xD390261Eu, PT_CH_DYN_THR },
+    { 0xD588F391u, PT_CH_GATE_ON },
+    { 0xD6E23560u, PT_CH_DYN_ATTACK },
+    { 0xDA183334u, PT_CH_GATE_ATTACK },
+    { 0xDAF1FEDDu, PT_CH_DYN_ON },
+    { 0xDEAA8F43u, PT_STAT_SOLO },
+    { 0xDF865B65u, PT_CH_GATE_RELEASE },
+    { 0xE37DE7A3u, PT_CH_DYN_KNEE },
+    { 0xE6DAC345u, PT_CH_GATE_HOLD },
+    { 0xEB786A99u, PT_BUS_CONFIG_COLOR },
+    { 0xEBC5C822u, PT_ACTION_SETCLOCK },
+    { 0xF6B35F84u, PT_CONFIG_CHLINK_1_2 },
+    { 0xF6B35F84u, PT_CONFIG_CHLINK_3_4 },
+    { 0xF6B35F84u, PT_CONFIG_CHLINK_5_6 },
+    { 0xF6B35F84u, PT_CONFIG_CHLINK_7_8 },
+    { 0xF6B35F84u, PT_CONFIG_CHLINK_9_10 },
+    { 0xF6B35F84u, PT_CONFIG_CHLINK_11_12 },
+    { 0xF6B35F84u, PT_CONFIG_CHLINK_13_14 },
+    { 0xF6B35F84u, PT_CONFIG_CHLINK_15_16 },
+    { 0xFE88CED2u, PT_CH_GATE_THR },
+    { 0xFE9A5FC9u, PT_SNAP_NAME },
+};
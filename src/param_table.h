@@ -0,0 +1,77 @@
+// Generated by gen_param_table.py from docs/X18_OSC_Commands.json - do not edit
+
+#ifndef PARAM_TABLE_H
+#define PARAM_TABLE_H
+
+typedef enum {
+    PT_ACTION_CLEARSOLO,         // /-action/clearsolo
+    PT_ACTION_INITALL,           // /-action/initall
+    PT_ACTION_SAVESTATE,         // /-action/savestate
+    PT_ACTION_SETCLOCK,          // /-action/setclock
+    PT_CH_CONFIG_NAME,           // /ch/01/config/name
+    PT_CH_CONFIG_COLOR,          // /ch/01/config/color
+    PT_CH_CONFIG_INSRC,          // /ch/01/config/insrc
+    PT_CH_MIX_FADER,             // /ch/01/mix/fader
+    PT_CH_MIX_ON,                // /ch/01/mix/on
+    PT_CH_MIX_PAN,               // /ch/01/mix/pan
+    PT_CH_MIX_LR,                // /ch/01/mix/lr
+    PT_CH_SEND_LEVEL,            // /ch/01/mix/01/level
+    PT_CH_SEND_PAN,              // /ch/01/mix/01/pan
+    PT_CH_PREAMP_GAIN,           // /ch/01/preamp/gain
+    PT_CH_PREAMP_HPF,            // /ch/01/preamp/hpf
+    PT_CH_PREAMP_HPON,           // /ch/01/preamp/hpon
+    PT_CH_EQ_ON,                 // /ch/01/eq/on
+    PT_CH_EQ_TYPE,               // /ch/01/eq/1/type
+    PT_CH_EQ_F,                  // /ch/01/eq/1/f
+    PT_CH_EQ_G,                  // /ch/01/eq/1/g
+    PT_CH_EQ_Q,                  // /ch/01/eq/1/q
+    PT_CH_GATE_ON,               // /ch/01/gate/on
+    PT_CH_GATE_MODE,             // /ch/01/gate/mode
+    PT_CH_GATE_THR,              // /ch/01/gate/thr
+    PT_CH_GATE_RANGE,            // /ch/01/gate/range
+    PT_CH_GATE_ATTACK,           // /ch/01/gate/attack
+    PT_CH_GATE_HOLD,             // /ch/01/gate/hold
+    PT_CH_GATE_RELEASE,          // /ch/01/gate/release
+    PT_CH_DYN_ON,                // /ch/01/dyn/on
+    PT_CH_DYN_MODE,              // /ch/01/dyn/mode
+    PT_CH_DYN_THR,               // /ch/01/dyn/thr
+    PT_CH_DYN_RATIO,             // /ch/01/dyn/ratio
+    PT_CH_DYN_KNEE,              // /ch/01/dyn/knee
+    PT_CH_DYN_MGAIN,             // /ch/01/dyn/mgain
+    PT_CH_DYN_ATTACK,            // /ch/01/dyn/attack
+    PT_CH_DYN_HOLD,              // /ch/01/dyn/hold
+    PT_CH_DYN_RELEASE,           // /ch/01/dyn/release
+    PT_BUS_CONFIG_NAME,          // /bus/1/config/name
+    PT_BUS_CONFIG_COLOR,         // /bus/1/config/color
+    PT_BUS_MIX_FADER,            // /bus/1/mix/fader
+    PT_BUS_MIX_ON,               // /bus/1/mix/on
+    PT_LR_CONFIG_NAME,           // /lr/config/name
+    PT_LR_MIX_FADER,             // /lr/mix/fader
+    PT_LR_MIX_ON,                // /lr/mix/on
+    PT_DCA_CONFIG_NAME,          // /dca/1/config/name
+    PT_DCA_CONFIG_COLOR,         // /dca/1/config/color
+    PT_DCA_FADER,                // /dca/1/fader
+    PT_DCA_ON,                   // /dca/1/on
+    PT_HEADAMP_GAIN,             // /headamp/01/gain
+    PT_HEADAMP_PHANTOM,          // /headamp/01/phantom
+    PT_CONFIG_CHLINK_1_2,        // /config/chlink/1-2
+    PT_CONFIG_CHLINK_3_4,        // /config/chlink/3-4
+    PT_CONFIG_CHLINK_5_6,        // /config/chlink/5-6
+    PT_CONFIG_CHLINK_7_8,        // /config/chlink/7-8
+    PT_CONFIG_CHLINK_9_10,       // /config/chlink/9-10
+    PT_CONFIG_CHLINK_11_12,      // /config/chlink/11-12
+    PT_CONFIG_CHLINK_13_14,      // /config/chlink/13-14
+    PT_CONFIG_CHLINK_15_16,      // /config/chlink/15-16
+    PT_CONFIG_MUTE,              // /config/mute/1
+    PT_SNAP_INDEX,               // /-snap/index
+    PT_SNAP_LOAD,                // /-snap/load
+    PT_SNAP_SAVE,                // /-snap/save
+    PT_SNAP_NAME,                // /-snap/name
+    PT_STAT_SOLO,                // /-stat/solo
+    PT_STAT_SOLOSW,              // /-stat/solosw/01
+    PT_COUNT
+} ParamTemplateId;
+
+#define PARAM_LOOKUP_SIZE 65
+
+#endif
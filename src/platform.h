@@ -0,0 +1,47 @@
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+// ============================================================================
+// PLATFORM
+// ============================================================================
+// Everything outside the UI (show model and files, OSC, cue engine, link
+// monitoring) includes this instead of <3ds.h>, so it also builds on a Linux
+// host (Makefile.host) for benchmarks and tests without hardware.
+//
+//   Time      svcGetSystemTick(), CPU_TICKS_PER_MSEC/USEC, svcSleepThread()
+//   Threads   threadCreate/Join/Free, LightLock, LightEvent
+//   Sockets   BSD sockets and poll(), the same on both
+//   Files     stdio under PLATFORM_DATA_DIR
+//
+// On the 3DS these are libctru itself. The host build maps the same subset
+// onto POSIX (host/platform_posix.h). What libctru has no portable
+// counterpart for is behind the platform_* calls below.
+
+#ifdef __3DS__
+#include <3ds.h>
+#else
+#include "platform_posix.h"
+#endif
+
+// Where the app keeps shows, options, logs and snapshot tables
+#ifndef PLATFORM_DATA_DIR
+#ifdef __3DS__
+#define PLATFORM_DATA_DIR "/3ds/x18mixer"
+#else
+#define PLATFORM_DATA_DIR "x18mixer"
+#endif
+#endif
+
+void platform_init(void);           // After socInit() on the 3DS
+void platform_exit(void);
+
+// Wi-Fi associated and an address assigned
+int platform_network_up(void);
+// Our address and netmask, host byte order; 0 if not on a network
+int platform_local_subnet(u32 *ip, u32 *mask);
+// Called (from the main thread) after sleep or a return from the HOME menu
+void platform_on_resume(void (*callback)(void));
+// This frame's buttons (libctru KEY_* bits) and touch point; see input.h
+void platform_input_read(u32 *down, u32 *held, u16 *touch_x, u16 *touch_y);
+
+#endif
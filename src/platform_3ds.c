@@ -0,0 +1,84 @@
+#include <string.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "platform.h"
+
+static aptHookCookie s_apt_cookie;
+static int s_apt_hooked = 0;
+static int s_ac_ready = 0;
+static void (*s_resume_callback)(void) = NULL;
+
+// ============================================================================
+// APT / AC
+// ============================================================================
+
+static void apt_hook(APT_HookType hook, void *param)
+{
+    (void)param;
+    if ((hook == APTHOOK_ONWAKEUP || hook == APTHOOK_ONRESTORE) && s_resume_callback) {
+        s_resume_callback();
+    }
+}
+
+void platform_init(void)
+{
+    s_ac_ready = R_SUCCEEDED(acInit());
+}
+
+void platform_exit(void)
+{
+    if (s_apt_hooked) {
+        aptUnhook(&s_apt_cookie);
+        s_apt_hooked = 0;
+    }
+    if (s_ac_ready) {
+        acExit();
+        s_ac_ready = 0;
+    }
+}
+
+int platform_network_up(void)
+{
+    if (s_ac_ready) {
+        u32 status = 0;
+        if (R_FAILED(ACU_GetWifiStatus(&status)) || status == 0) return 0;
+    }
+    return gethostid() != 0;
+}
+
+int platform_local_subnet(u32 *ip, u32 *mask)
+{
+    struct in_addr addr, netmask, broadcast;
+    if (R_SUCCEEDED(SOCU_GetIPInfo(&addr, &netmask, &broadcast)) && addr.s_addr) {
+        *ip = ntohl(addr.s_addr);
+        *mask = ntohl(netmask.s_addr);
+        return 1;
+    }
+
+    // Older firmware: the address alone, assume a /24
+    *ip = ntohl((u32)gethostid());
+    *mask = 0xFFFFFF00u;
+    return *ip != 0;
+}
+
+void platform_on_resume(void (*callback)(void))
+{
+    s_resume_callback = callback;
+    if (!s_apt_hooked) {
+        aptHook(&s_apt_cookie, apt_hook, NULL);
+        s_apt_hooked = 1;
+    }
+}
+
+void platform_input_read(u32 *down, u32 *held, u16 *touch_x, u16 *touch_y)
+{
+    touchPosition touch;
+    hidScanInput();
+    *down = hidKeysDown();
+    *held = hidKeysHeld();
+    hidTouchRead(&touch);
+    *touch_x = touch.px;
+    *touch_y = touch.py;
+}
@@ -0,0 +1,322 @@
+#include "common.h"
+#include "profiler.h"
+
+// ============================================================================
+// STATE
+// ============================================================================
+
+typedef struct {
+    u64 start_tick;
+    u64 frame_ticks;                 // Accumulated in the current frame
+    int hit;                         // Phase ran in the current frame
+
+    // Current window
+    u32 win_count;
+    u64 win_sum_us;
+    u32 win_max_us;
+    u16 win_hist[PROF_HIST_BUCKETS];
+
+    // Last completed window (what the overlay shows)
+    float avg_ms;
+    float p99_ms;
+    float worst_ms;
+
+    // Cumulative since start (what the CSV contains)
+    u32 hist[PROF_HIST_BUCKETS];
+} ProfPhaseStats;
+
+typedef struct {
+    float sum;
+    float max;
+    float avg_shown;
+    float max_shown;
+} ProfGauge;
+
+static const char *s_phase_names[PROF_NUM_PHASES] = {
+    "hid_scan", "touch", "input", "send_step",
+    "render_top", "render_bot", "frame_end", "vblank", "frame"
+};
+
+static ProfPhaseStats s_phases[PROF_NUM_PHASES];
+static ProfGauge s_gpu_proc;     // ms, C3D_GetProcessingTime()
+static ProfGauge s_gpu_draw;     // ms, C3D_GetDrawingTime()
+static ProfGauge s_cmdbuf;       // %, C3D_GetCmdBufUsage()
+static ProfGauge s_objects;      // C2D objects per frame
+static u32 s_window_frames = 0;
+static u64 s_last_frame_tick = 0;
+
+int g_prof_overlay_visible = 0;
+u32 g_prof_c2d_objects = 0;
+
+// ============================================================================
+// HISTOGRAM BUCKETS
+// ============================================================================
+
+// Log-linear buckets in microseconds: exact below 8us, then 4 sub-buckets per
+// octave (<25% relative error) up to ~130ms. The last bucket is open-ended.
+static int prof_bucket(u32 us)
+{
+    if (us < 4) return (int)us;
+    int octave = 31 - __builtin_clz(us);
+    int idx = 4 * (octave - 1) + ((us >> (octave - 2)) & 3);
+    return (idx < PROF_HIST_BUCKETS) ? idx : PROF_HIST_BUCKETS - 1;
+}
+
+static u32 prof_bucket_lo(int idx)
+{
+    if (idx < 4) return (u32)idx;
+    int octave = idx / 4 + 1;
+    return (u32)(4 + idx % 4) << (octave - 2);
+}
+
+static u32 prof_ticks_to_us(u64 ticks)
+{
+    return (u32)((ticks * 1000000ULL) / SYSCLOCK_ARM11);
+}
+
+// ============================================================================
+// PROBES
+// ============================================================================
+
+void prof_init(void)
+{
+    memset(s_phases, 0, sizeof(s_phases));
+    memset(&s_gpu_proc, 0, sizeof(s_gpu_proc));
+    memset(&s_gpu_draw, 0, sizeof(s_gpu_draw));
+    memset(&s_cmdbuf, 0, sizeof(s_cmdbuf));
+    memset(&s_objects, 0, sizeof(s_objects));
+    s_window_frames = 0;
+    s_last_frame_tick = svcGetSystemTick();
+    g_prof_c2d_objects = 0;
+}
+
+void prof_begin(ProfPhase phase)
+{
+    s_phases[phase].start_tick = svcGetSystemTick();
+}
+
+void prof_end(ProfPhase phase)
+{
+    ProfPhaseStats *p = &s_phases[phase];
+    p->frame_ticks += svcGetSystemTick() - p->start_tick;
+    p->hit = 1;
+}
+
+static void prof_gauge_add(ProfGauge *g, float value)
+{
+    g->sum += value;
+    if (value > g->max) g->max = value;
+}
+
+static void prof_gauge_roll(ProfGauge *g, u32 frames)
+{
+    g->avg_shown = frames ? g->sum / frames : 0.0f;
+    g->max_shown = g->max;
+    g->sum = 0.0f;
+    g->max = 0.0f;
+}
+
+// p99 from a window histogram, reported as the bucket upper bound (capped at
+// the exact worst sample so short windows don't overstate it)
+static float prof_window_p99_ms(const ProfPhaseStats *p)
+{
+    u32 target = p->win_count - p->win_count / 100;
+    u32 seen = 0;
+    for (int b = 0; b < PROF_HIST_BUCKETS; b++) {
+        seen += p->win_hist[b];
+        if (seen >= target) {
+            u32 hi = prof_bucket_lo(b + 1);
+            if (hi > p->win_max_us) hi = p->win_max_us;
+            return hi / 1000.0f;
+        }
+    }
+    return p->win_max_us / 1000.0f;
+}
+
+// Close the frame: fold this frame's samples into the window and cumulative
+// histograms, and publish window stats every PROF_WINDOW_FRAMES frames
+void prof_frame_end(void)
+{
+    u64 now = svcGetSystemTick();
+    s_phases[PROF_FRAME].frame_ticks = now - s_last_frame_tick;
+    s_phases[PROF_FRAME].hit = 1;
+    s_last_frame_tick = now;
+
+    for (int i = 0; i < PROF_NUM_PHASES; i++) {
+        ProfPhaseStats *p = &s_phases[i];
+        if (!p->hit) continue;
+
+        u32 us = prof_ticks_to_us(p->frame_ticks);
+        int b = prof_bucket(us);
+        p->win_count++;
+        p->win_sum_us += us;
+        if (us > p->win_max_us) p->win_max_us = us;
+        p->win_hist[b]++;
+        p->hist[b]++;
+
+        p->frame_ticks = 0;
+        p->hit = 0;
+    }
+
+    prof_gauge_add(&s_gpu_proc, C3D_GetProcessingTime());
+    prof_gauge_add(&s_gpu_draw, C3D_GetDrawingTime());
+    prof_gauge_add(&s_cmdbuf, C3D_GetCmdBufUsage() * 100.0f);
+    prof_gauge_add(&s_objects, (float)g_prof_c2d_objects);
+    g_prof_c2d_objects = 0;
+
+    if (++s_window_frames < PROF_WINDOW_FRAMES) return;
+
+    for (int i = 0; i < PROF_NUM_PHASES; i++) {
+        ProfPhaseStats *p = &s_phases[i];
+        if (p->win_count > 0) {
+            p->avg_ms = (float)p->win_sum_us / p->win_count / 1000.0f;
+            p->p99_ms = prof_window_p99_ms(p);
+            p->worst_ms = p->win_max_us / 1000.0f;
+        }
+        p->win_count = 0;
+        p->win_sum_us = 0;
+        p->win_max_us = 0;
+        memset(p->win_hist, 0, sizeof(p->win_hist));
+    }
+    prof_gauge_roll(&s_gpu_proc, s_window_frames);
+    prof_gauge_roll(&s_gpu_draw, s_window_frames);
+    prof_gauge_roll(&s_cmdbuf, s_window_frames);
+    prof_gauge_roll(&s_objects, s_window_frames);
+    s_window_frames = 0;
+}
+
+// ============================================================================
+// INPUT
+// ============================================================================
+
+// Returns 1 while the profiler combo is held so the caller skips the normal
+// input handlers for that frame
+int prof_handle_input(u32 kDown, u32 kHeld)
+{
+    const u32 combo = KEY_ZL | KEY_ZR;
+    if ((kHeld & combo) != combo) return 0;
+
+    if (kDown & combo) {
+        g_prof_overlay_visible = !g_prof_overlay_visible;
+    }
+
+    if (kDown & KEY_Y) {
+        if (prof_dump_histogram_csv(PROF_CSV_PATH)) {
+            snprintf(g_save_status, sizeof(g_save_status), "OK: Profile saved to %s", PROF_CSV_PATH);
+        } else {
+            snprintf(g_save_status, sizeof(g_save_status), "ERROR: Cannot write %s", PROF_CSV_PATH);
+        }
+        g_save_status_timer = 120;
+    }
+
+    if (kDown & KEY_X) {
+#ifdef X18_TRACE
+        if (TRACE_FLUSH()) {
+            snprintf(g_save_status, sizeof(g_save_status), "OK: Trace saved to %s", TRACE_JSON_PATH);
+        } else {
+            snprintf(g_save_status, sizeof(g_save_status), "ERROR: Cannot write %s", TRACE_JSON_PATH);
+        }
+#else
+        snprintf(g_save_status, sizeof(g_save_status), "Tracing not built in (make TRACE=1)");
+#endif
+        g_save_status_timer = 120;
+    }
+    return 1;
+}
+
+// ============================================================================
+// CSV DUMP
+// ============================================================================
+
+int prof_dump_histogram_csv(const char *path)
+{
+    create_shows_directory();
+
+    FILE *f = fopen(path, "w");
+    if (!f) return 0;
+
+    fprintf(f, "bucket_lo_us,bucket_hi_us");
+    for (int i = 0; i < PROF_NUM_PHASES; i++) {
+        fprintf(f, ",%s", s_phase_names[i]);
+    }
+    fprintf(f, "\n");
+
+    for (int b = 0; b < PROF_HIST_BUCKETS; b++) {
+        if (b == PROF_HIST_BUCKETS - 1) {
+            fprintf(f, "%lu,inf", (unsigned long)prof_bucket_lo(b));
+        } else {
+            fprintf(f, "%lu,%lu", (unsigned long)prof_bucket_lo(b), (unsigned long)prof_bucket_lo(b + 1));
+        }
+        for (int i = 0; i < PROF_NUM_PHASES; i++) {
+            fprintf(f, ",%lu", (unsigned long)s_phases[i].hist[b]);
+        }
+        fprintf(f, "\n");
+    }
+
+    fclose(f);
+    return 1;
+}
+
+// ============================================================================
+// OVERLAY
+// ============================================================================
+
+// Overlay text is drawn above everything else (draw_debug_text uses 0.5f)
+static void prof_text(const char *text, float x, float y, u32 color)
+{
+    C2D_Text c2d_text;
+    C2D_TextBufClear(g_textBuf);
+    if (g_font) {
+        C2D_TextFontParse(&c2d_text, g_font, g_textBuf, text);
+    } else {
+        C2D_TextParse(&c2d_text, g_textBuf, text);
+    }
+    C2D_TextOptimize(&c2d_text);
+    C2D_DrawText(&c2d_text, C2D_WithColor, x, y, 1.0f, 0.42f, 0.42f, color);
+}
+
+// Draws on the top screen; call after the normal top/bottom rendering
+void prof_render_overlay(void)
+{
+    if (!g_prof_overlay_visible || !g_textBuf) return;
+
+    u32 clrBg = C2D_Color32(0x00, 0x00, 0x00, 0xC8);
+    u32 clrHead = C2D_Color32(0x00, 0xFF, 0xFF, 0xFF);
+    u32 clrText = C2D_Color32(0xFF, 0xFF, 0xFF, 0xFF);
+    u32 clrWarn = C2D_Color32(0xFF, 0x60, 0x40, 0xFF);
+
+    C2D_SceneBegin(g_topScreen.target);
+    C2D_DrawRectSolid(0, 0, 0.99f, SCREEN_WIDTH_TOP, SCREEN_HEIGHT_TOP, clrBg);
+
+    char line[96];
+    float y = 2.0f;
+
+    prof_text("PROFILER (ms)       avg     p99    worst", 6.0f, y, clrHead);
+    y += 13.0f;
+
+    for (int i = 0; i < PROF_NUM_PHASES; i++) {
+        const ProfPhaseStats *p = &s_phases[i];
+        snprintf(line, sizeof(line), "%-12s %7.2f %7.2f %7.2f",
+                 s_phase_names[i], p->avg_ms, p->p99_ms, p->worst_ms);
+        // Anything that can blow a 60Hz frame on its own is highlighted
+        prof_text(line, 6.0f, y, (p->worst_ms > 16.7f) ? clrWarn : clrText);
+        y += 13.0f;
+    }
+
+    y += 4.0f;
+    snprintf(line, sizeof(line), "GPU proc  %6.2f avg %6.2f max", s_gpu_proc.avg_shown, s_gpu_proc.max_shown);
+    prof_text(line, 6.0f, y, clrText);
+    y += 13.0f;
+    snprintf(line, sizeof(line), "GPU draw  %6.2f avg %6.2f max", s_gpu_draw.avg_shown, s_gpu_draw.max_shown);
+    prof_text(line, 6.0f, y, clrText);
+    y += 13.0f;
+    snprintf(line, sizeof(line), "Cmdbuf    %5.1f%% avg %5.1f%% max", s_cmdbuf.avg_shown, s_cmdbuf.max_shown);
+    prof_text(line, 6.0f, y, clrText);
+    y += 13.0f;
+    snprintf(line, sizeof(line), "C2D objs  %6.0f avg %6.0f max (limit %d)",
+             s_objects.avg_shown, s_objects.max_shown, C2D_DEFAULT_MAX_OBJECTS);
+    prof_text(line, 6.0f, y, (s_objects.max_shown > C2D_DEFAULT_MAX_OBJECTS * 0.9f) ? clrWarn : clrText);
+    y += 16.0f;
+
+    prof_text("ZL+ZR: hide   ZL+ZR+Y: save histogram CSV", 6.0f, y, clrHead);
+}
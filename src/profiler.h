@@ -0,0 +1,52 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <citro2d.h>
+#include "platform.h"
+
+// ============================================================================
+// FRAME PROFILER
+// ============================================================================
+// Scoped tick probes around the phases of the main loop. Samples are folded
+// into per-phase histograms at the end of every frame; the overlay shows the
+// last completed window (PROF_WINDOW_FRAMES frames).
+//
+// ZL+ZR      : toggle overlay (top screen)
+// ZL+ZR + Y  : dump cumulative histograms to PROF_CSV_PATH
+// ZL+ZR + X  : write the event trace (see trace.h)
+
+#define PROF_WINDOW_FRAMES  120
+#define PROF_HIST_BUCKETS   64
+#define PROF_CSV_PATH       PLATFORM_DATA_DIR "/prof_hist.csv"
+
+typedef enum {
+    PROF_HID_SCAN,      // hidScanInput()
+    PROF_TOUCH,         // update_touch_input()
+    PROF_INPUT,         // Input handlers (includes PROF_SEND_STEP)
+    PROF_SEND_STEP,     // send_step_osc()
+    PROF_RENDER_TOP,    // render_top_screen()
+    PROF_RENDER_BOT,    // bottom screen (mixer, manager, options...)
+    PROF_FRAME_END,     // C3D_FrameEnd()
+    PROF_VBLANK,        // gspWaitForVBlank()
+    PROF_FRAME,         // whole loop iteration
+    PROF_NUM_PHASES
+} ProfPhase;
+
+extern int g_prof_overlay_visible;
+extern u32 g_prof_c2d_objects;  // C2D objects submitted in the current frame
+
+void prof_init(void);
+void prof_begin(ProfPhase phase);
+void prof_end(ProfPhase phase);
+void prof_frame_end(void);
+int prof_handle_input(u32 kDown, u32 kHeld);
+void prof_render_overlay(void);
+int prof_dump_histogram_csv(const char *path);
+
+// Count every C2D object drawn by the UI without touching the call sites.
+// Text is counted per glyph in draw_debug_text().
+#define C2D_DrawRectSolid(...) (g_prof_c2d_objects++, C2D_DrawRectSolid(__VA_ARGS__))
+#define C2D_DrawRectangle(...) (g_prof_c2d_objects++, C2D_DrawRectangle(__VA_ARGS__))
+#define C2D_DrawImageAt(...)   (g_prof_c2d_objects++, C2D_DrawImageAt(__VA_ARGS__))
+
+#endif
@@ -7,6 +7,11 @@
 #include "show_info_panel.h"
 #include "eq_window.h"
 #include "options_window.h"
+#include "cue_engine.h"
+#include "snap_offload.h"
+#include "go_verify.h"
+#include "link_health.h"
+#include "osc_targets.h"
 
 // Color constants
 #define CLR_BG_DARK C2D_Color32(0x1A, 0x1A, 0x1A, 0xFF)
@@ -78,6 +83,38 @@ void render_top_screen(void)
         snprintf(step_count_str, sizeof(step_count_str), "Steps: %d", g_current_show.num_steps);
         draw_debug_text(&g_topScreen, step_count_str, SCREEN_WIDTH_TOP - 150, 8.0f, 0.50f, CLR_WHITE);
         
+        // Link quality: state dot, p50/p99 round trip and loss of the /xinfo probes
+        LinkHealth link;
+        link_health_get(&link);
+        u32 link_color = (link.state == LINK_GOOD) ? CLR_GREEN :
+                         (link.state == LINK_DEGRADED) ? CLR_YELLOW :
+                         (link.state == LINK_DEAD) ? CLR_RED : CLR_BORDER;
+        C2D_DrawRectSolid(SCREEN_WIDTH_TOP - 84, 13, 0.5f, 8, 8, link_color);
+        
+        // Fan-out targets: one small dot each under the mixer's
+        for (int t = 1; t < osc_target_count(); t++) {
+            LinkHealth target;
+            link_health_get_target(t, &target);
+            u32 target_color = (target.state == LINK_GOOD) ? CLR_GREEN :
+                               (target.state == LINK_DEGRADED) ? CLR_YELLOW :
+                               (target.state == LINK_DEAD) ? CLR_RED : CLR_BORDER;
+            C2D_DrawRectSolid(SCREEN_WIDTH_TOP - 88 + (t - 1) * 6, 25, 0.5f, 4, 4, target_color);
+        }
+        char link_str[32];
+        if (link.state == LINK_DEAD) {
+            snprintf(link_str, sizeof(link_str), "NO LINK");
+        } else if (link.probes > link.lost) {
+            snprintf(link_str, sizeof(link_str), "%lu/%lu ms", (unsigned long)((link.p50_us + 500) / 1000),
+                     (unsigned long)((link.p99_us + 500) / 1000));
+        } else {
+            snprintf(link_str, sizeof(link_str), "-- ms");
+        }
+        draw_debug_text(&g_topScreen, link_str, SCREEN_WIDTH_TOP - 72, 5.0f, 0.40f, link_color);
+        if (link.probes) {
+            snprintf(link_str, sizeof(link_str), "%u%% loss", (unsigned)(link.lost * 100 / link.probes));
+            draw_debug_text(&g_topScreen, link_str, SCREEN_WIDTH_TOP - 72, 19.0f, 0.40f, CLR_WHITE);
+        }
+        
         // ===== STEPS LISTBOX =====
         // Listbox background
         C2D_DrawRectSolid(0, 35, 0.5f, SCREEN_WIDTH_TOP, 160, CLR_BG_MID);
@@ -105,6 +142,29 @@ void render_top_screen(void)
             snprintf(step_text, sizeof(step_text), "[%3d] %-25s", i + 1, g_current_show.steps[i].name);
             draw_debug_text(&g_topScreen, step_text, 15.0f, list_y, 0.50f, step_color);
             
+            // Auto-follow: "+2.0" after the previous step, "@75.0" from show start
+            const Step *st = &g_current_show.steps[i];
+            if (st->follow_mode != STEP_FOLLOW_NONE) {
+                char follow_text[16];
+                snprintf(follow_text, sizeof(follow_text), "%c%lu.%lu",
+                         (st->follow_mode == STEP_FOLLOW_AT) ? '@' : '+',
+                         (unsigned long)(st->follow_ms / 1000), (unsigned long)(st->follow_ms % 1000 / 100));
+                draw_debug_text(&g_topScreen, follow_text, SCREEN_WIDTH_TOP - 120, list_y, 0.50f, step_color);
+            }
+            
+            // Fade time, right-aligned
+            int fade = g_current_show.steps[i].fade_tenths;
+            if (fade) {
+                char fade_text[16];
+                snprintf(fade_text, sizeof(fade_text), "%d.%ds", fade / 10, fade % 10);
+                draw_debug_text(&g_topScreen, fade_text, SCREEN_WIDTH_TOP - 60, list_y, 0.50f, step_color);
+            }
+            
+            // Recalled from its X18 snapshot slot
+            if (snap_offload_ready(i)) {
+                draw_debug_text(&g_topScreen, "S", SCREEN_WIDTH_TOP - 18, list_y, 0.50f, CLR_GREEN);
+            }
+            
             list_y += 20.0f;
         }
         
@@ -141,6 +201,33 @@ void render_top_screen(void)
                  g_selected_step + 1, g_current_show.num_steps,
                  (int)(g_faders[0].value * 100));
         draw_debug_text(&g_topScreen, info_str, 208.0f, 213.0f, 0.50f, CLR_WHITE);
+        
+        // Auto-follow countdown, snapshot upload, last GO check, else timing of
+        // the last followed steps
+        u32 remaining_ms;
+        int next = cue_follow_pending(&remaining_ms);
+        CueJitterStats jitter;
+        cue_jitter_stats(&jitter);
+        int snap_done, snap_total;
+        GoVerifyStats verify;
+        go_verify_stats(&verify);
+        if (next >= 0) {
+            snprintf(info_str, sizeof(info_str), "Next: %d in %lu.%lus", next + 1,
+                     (unsigned long)(remaining_ms / 1000), (unsigned long)(remaining_ms % 1000 / 100));
+            draw_debug_text(&g_topScreen, info_str, 208.0f, 226.0f, 0.40f, CLR_YELLOW);
+        } else if (snap_offload_progress(&snap_done, &snap_total)) {
+            snprintf(info_str, sizeof(info_str), "Snapshot upload %d/%d", snap_done, snap_total);
+            draw_debug_text(&g_topScreen, info_str, 208.0f, 226.0f, 0.40f, CLR_YELLOW);
+        } else if (g_options.verify_go && verify.step_idx >= 0) {
+            snprintf(info_str, sizeof(info_str), "GO %d: %u/%u lost, %u resent, %u bad",
+                     verify.step_idx + 1, verify.lost, verify.checked, verify.resent, verify.unresolved);
+            draw_debug_text(&g_topScreen, info_str, 208.0f, 226.0f, 0.40f,
+                            verify.unresolved ? CLR_RED : (verify.lost ? CLR_YELLOW : CLR_WHITE));
+        } else if (jitter.count) {
+            snprintf(info_str, sizeof(info_str), "Follow jitter avg %ld max %ld us",
+                     (long)(jitter.sum_us / jitter.count), (long)jitter.max_us);
+            draw_debug_text(&g_topScreen, info_str, 208.0f, 226.0f, 0.40f, CLR_WHITE);
+        }
     }
 }
 
@@ -210,18 +297,19 @@ void render_bot_screen(void)
         draw_debug_text(&g_botScreen, "Eq", f->x + 2, 7, 0.50f, clrText);
         
         // Channel number (below EQ button) - LARGER and CENTERED
+        // Orange: safe for the whole show, gray: not recalled by this step
+        u32 label_color = clrText;
+        if (g_current_show.channel_safes & (1 << i)) {
+            label_color = C2D_Color32(0xFF, 0x99, 0x00, 0xFF);
+        } else if (g_current_show.steps[g_selected_step].released_channels & (1 << i)) {
+            label_color = C2D_Color32(0x70, 0x70, 0x70, 0xFF);
+        }
         char label[4];
         snprintf(label, sizeof(label), "%d", f->id);
-        draw_debug_text(&g_botScreen, label, f->x + f->w / 2 - 4, 20, 0.50f, clrText);
+        draw_debug_text(&g_botScreen, label, f->x + f->w / 2 - 4, 20, 0.50f, label_color);
         
         // Volume in dB (calibrated scale) - LARGER and CENTERED
-        char vol_str[8];
-        float db = fader_value_to_db(f->value);
-        if (db <= -100.0f) {
-            snprintf(vol_str, sizeof(vol_str), "-inf");
-        } else {
-            snprintf(vol_str, sizeof(vol_str), "%.0f", db);
-        }
+        const char *vol_str = fader_step_to_string(fader_value_to_step(f->value));
         draw_debug_text(&g_botScreen, vol_str, f->x + f->w / 2 - 5, 30, 0.50f, clrText);
         
         // ===== FADER TRACK WITH SCALE MARKS =====
@@ -300,8 +388,14 @@ void render_bot_screen(void)
 void render_frame(void)
 {
     C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+    prof_begin(PROF_RENDER_TOP);
+    TRACE_BEGIN("render_top");
     render_top_screen();
+    TRACE_END("render_top");
+    prof_end(PROF_RENDER_TOP);
     
+    prof_begin(PROF_RENDER_BOT);
+    TRACE_BEGIN("render_bot");
     if (g_app_mode == APP_MODE_MIXER) {
         render_bot_screen();  // Always show mixer on bottom screen
     } else if (g_options_window_open) {
@@ -318,6 +412,14 @@ void render_frame(void)
             render_net_config_window();
         }
     }
+    TRACE_END("render_bot");
+    prof_end(PROF_RENDER_BOT);
+    
+    prof_render_overlay();
     
+    prof_begin(PROF_FRAME_END);
+    TRACE_BEGIN("frame_end");
     C3D_FrameEnd(0);
+    TRACE_END("frame_end");
+    prof_end(PROF_FRAME_END);
 }
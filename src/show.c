@@ -0,0 +1,416 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "show.h"
+#include "log.h"
+
+// ============================================================================
+// GLOBAL STATE
+// ============================================================================
+
+Show g_current_show = {{0}};
+
+// ============================================================================
+// SHOW MODEL
+// ============================================================================
+
+// Initialize EQ with default values
+void init_channel_eq(ChannelEQ *eq)
+{
+    eq->enabled = 0;  // EQ disabled by default
+    
+    // Band 0: 64Hz Low Cut
+    eq->bands[0].frequency = 64.0f;
+    eq->bands[0].gain = 0.0f;
+    eq->bands[0].q_factor = 0.5f;
+    eq->bands[0].type = EQ_LCUT;
+    
+    // Band 1: 200Hz Peaking EQ
+    eq->bands[1].frequency = 200.0f;
+    eq->bands[1].gain = 0.0f;
+    eq->bands[1].q_factor = 5.0f;
+    eq->bands[1].type = EQ_PEQ;
+    
+    // Band 2: 500Hz Peaking EQ
+    eq->bands[2].frequency = 500.0f;
+    eq->bands[2].gain = 0.0f;
+    eq->bands[2].q_factor = 5.0f;
+    eq->bands[2].type = EQ_PEQ;
+    
+    // Band 3: 1200Hz Peaking EQ
+    eq->bands[3].frequency = 1200.0f;
+    eq->bands[3].gain = 0.0f;
+    eq->bands[3].q_factor = 5.0f;
+    eq->bands[3].type = EQ_PEQ;
+    
+    // Band 4: 4500Hz High Shelf
+    eq->bands[4].frequency = 4500.0f;
+    eq->bands[4].gain = 0.0f;
+    eq->bands[4].q_factor = 0.5f;
+    eq->bands[4].type = EQ_HSHV;
+}
+
+// Release the steps' parameter lists and zero the whole show.
+// The show must be zeroed or valid already (never raw malloc memory).
+void show_clear(Show *show)
+{
+    for (int s = 0; s < 200; s++) {
+        param_list_free(&show->steps[s].params);
+    }
+    memset(show, 0, sizeof(Show));
+}
+
+// ============================================================================
+// SHOW FILES
+// ============================================================================
+
+// Show file format v3 (little-endian, as written by the 3DS):
+//
+//   ShowFileHeader
+//   per step: u32 record length (bytes that follow)
+//             Step fixed part (STEP_CORE_SIZE bytes)
+//             u16 param count, u16 reserved
+//             ParamEntry[count], sorted by id
+//             StepScopeRecord (missing in files written before scopes)
+//             StepFadeRecord (missing in files written before fades)
+//             StepFollowRecord (missing in files written before auto-follow)
+//
+// Readers skip whatever a record holds past the fields they know, so newer
+// versions can append to steps without breaking older builds.
+typedef struct {
+    u32 magic;              // SHOW_FILE_MAGIC_V3
+    char name[64];
+    u16 num_steps;
+    u16 channel_safes;      // Was reserved (0) before channel safes
+} __attribute__((packed)) ShowFileHeader;
+
+typedef struct {
+    u16 released_channels;
+    u8 released_groups;
+    u8 reserved;
+} __attribute__((packed)) StepScopeRecord;
+
+typedef struct {
+    u16 fade_tenths;
+    u16 channel_fade_tenths[16];
+} __attribute__((packed)) StepFadeRecord;
+
+typedef struct {
+    u8 follow_mode;
+    u8 reserved[3];
+    u32 follow_ms;
+} __attribute__((packed)) StepFollowRecord;
+
+static int write_show_v3(FILE *f, const Show *show)
+{
+    ShowFileHeader hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = SHOW_FILE_MAGIC_V3;
+    memcpy(hdr.name, show->name, sizeof(hdr.name));
+    hdr.num_steps = (u16)show->num_steps;
+    hdr.channel_safes = show->channel_safes;
+    if (fwrite(&hdr, sizeof(hdr), 1, f) != 1) return 0;
+    
+    for (int s = 0; s < show->num_steps; s++) {
+        const Step *step = &show->steps[s];
+        u16 count_reserved[2] = { step->params.count, 0 };
+        StepScopeRecord scope = { step->released_channels, step->released_groups, 0 };
+        StepFadeRecord fade;
+        fade.fade_tenths = step->fade_tenths;
+        memcpy(fade.channel_fade_tenths, step->channel_fade_tenths, sizeof(fade.channel_fade_tenths));
+        StepFollowRecord follow = { step->follow_mode, { 0, 0, 0 }, step->follow_ms };
+        u32 record_len = STEP_CORE_SIZE + sizeof(count_reserved) +
+                         step->params.count * sizeof(ParamEntry) + sizeof(scope) + sizeof(fade) +
+                         sizeof(follow);
+        
+        if (fwrite(&record_len, sizeof(record_len), 1, f) != 1) return 0;
+        if (fwrite(step, STEP_CORE_SIZE, 1, f) != 1) return 0;
+        if (fwrite(count_reserved, sizeof(count_reserved), 1, f) != 1) return 0;
+        if (step->params.count &&
+            fwrite(step->params.items, sizeof(ParamEntry), step->params.count, f) != step->params.count) {
+            return 0;
+        }
+        if (fwrite(&scope, sizeof(scope), 1, f) != 1) return 0;
+        if (fwrite(&fade, sizeof(fade), 1, f) != 1) return 0;
+        if (fwrite(&follow, sizeof(follow), 1, f) != 1) return 0;
+    }
+    return 1;
+}
+
+int show_write_stream(FILE *f, const Show *show)
+{
+    return write_show_v3(f, show);
+}
+
+int show_write_file(const char *path, const Show *show)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) return 0;
+    
+    int written = write_show_v3(f, show);
+    
+    // Ensure data is written
+    fflush(f);
+    fsync(fileno(f));
+    if (fclose(f) != 0) written = 0;
+    return written;
+}
+
+// Old format structures (for backward compatibility)
+typedef struct {
+    char name[32];
+    float volumes[16];
+    int mutes[16];
+    int eqs_old[16];  // OLD: was just an int flag
+} __attribute__((packed)) OldStep;
+
+typedef struct {
+    char name[64];
+    OldStep steps_old[200];
+    int num_steps;
+} __attribute__((packed)) OldShow;
+
+// Convert old show format to new format
+static void migrate_old_show_to_new(OldShow *old, Show *new_show)
+{
+    // CRITICAL: Initialize entire structure to zero first
+    memset(new_show, 0, sizeof(Show));
+    
+    strcpy(new_show->name, old->name);
+    new_show->num_steps = old->num_steps;
+    if (new_show->num_steps > 200) new_show->num_steps = 200;  // Sanity check
+    if (new_show->num_steps < 1) new_show->num_steps = 1;      // At least 1 step
+    
+    for (int s = 0; s < new_show->num_steps; s++) {
+        strcpy(new_show->steps[s].name, old->steps_old[s].name);
+        
+        for (int i = 0; i < 16; i++) {
+            new_show->steps[s].volumes[i] = old->steps_old[s].volumes[i];
+            new_show->steps[s].mutes[i] = old->steps_old[s].mutes[i];
+            
+            // Initialize new EQ structure
+            init_channel_eq(&new_show->steps[s].eqs[i]);
+            // Set enabled flag from old format
+            new_show->steps[s].eqs[i].enabled = old->steps_old[s].eqs_old[i];
+        }
+    }
+}
+
+// Version 2 format: raw dump of the Show struct before steps had a parameter
+// list (every step is exactly the v3 fixed part)
+typedef struct {
+    char name[64];
+    u8 steps[200][STEP_CORE_SIZE];
+    int num_steps;
+    int magic;
+} __attribute__((packed)) ShowV2;
+
+static int read_show_v3(FILE *f, long file_size, Show *out_show)
+{
+    ShowFileHeader hdr;
+    if (fread(&hdr, sizeof(hdr), 1, f) != 1) return 0;
+    if (hdr.num_steps < 1 || hdr.num_steps > 200) return 0;
+    
+    memcpy(out_show->name, hdr.name, sizeof(out_show->name));
+    out_show->name[sizeof(out_show->name) - 1] = '\0';
+    out_show->num_steps = hdr.num_steps;
+    out_show->magic = SHOW_MAGIC;
+    out_show->channel_safes = hdr.channel_safes;
+    
+    int dropped = 0;
+    for (int s = 0; s < out_show->num_steps; s++) {
+        Step *step = &out_show->steps[s];
+        u32 record_len;
+        u16 count_reserved[2];
+        
+        if (fread(&record_len, sizeof(record_len), 1, f) != 1) return 0;
+        long record_end = ftell(f) + (long)record_len;
+        if (record_len < STEP_CORE_SIZE + sizeof(count_reserved) || record_end > file_size) return 0;
+        
+        if (fread(step, STEP_CORE_SIZE, 1, f) != 1) return 0;
+        step->name[sizeof(step->name) - 1] = '\0';
+        if (fread(count_reserved, sizeof(count_reserved), 1, f) != 1) return 0;
+        
+        u16 count = count_reserved[0];
+        if (STEP_CORE_SIZE + sizeof(count_reserved) + count * sizeof(ParamEntry) > record_len) return 0;
+        
+        for (int i = 0; i < count; i++) {
+            ParamEntry e;
+            if (fread(&e, sizeof(e), 1, f) != 1) return 0;
+            // Parameters this build does not know (older catalogue) are dropped
+            if (!param_id_valid(e.id) || !param_step_valid(e.id, e.step)) {
+                dropped++;
+                continue;
+            }
+            if (!param_list_set(&step->params, e.id, e.step)) return 0;
+        }
+        
+        // Recall scope (older records end before it: recall everything)
+        if (record_end - ftell(f) >= (long)sizeof(StepScopeRecord)) {
+            StepScopeRecord scope;
+            if (fread(&scope, sizeof(scope), 1, f) != 1) return 0;
+            step->released_channels = scope.released_channels;
+            step->released_groups = scope.released_groups & STEP_SCOPE_ALL;
+        }
+        
+        // Fade times (older records: instant)
+        if (record_end - ftell(f) >= (long)sizeof(StepFadeRecord)) {
+            StepFadeRecord fade;
+            if (fread(&fade, sizeof(fade), 1, f) != 1) return 0;
+            step->fade_tenths = fade.fade_tenths;
+            memcpy(step->channel_fade_tenths, fade.channel_fade_tenths, sizeof(step->channel_fade_tenths));
+        }
+        
+        // Auto-follow (older records: manual)
+        if (record_end - ftell(f) >= (long)sizeof(StepFollowRecord)) {
+            StepFollowRecord follow;
+            if (fread(&follow, sizeof(follow), 1, f) != 1) return 0;
+            step->follow_mode = (follow.follow_mode < STEP_FOLLOW_MODES) ? follow.follow_mode : STEP_FOLLOW_NONE;
+            step->follow_ms = follow.follow_ms;
+        }
+        
+        // Skip fields appended by newer versions
+        if (fseek(f, record_end, SEEK_SET) != 0) return 0;
+    }
+    
+    if (dropped) LOG_WARN("[LOAD_SHOW] %d unknown params dropped", dropped);
+    return 1;
+}
+
+static int read_show_v2(FILE *f, Show *out_show)
+{
+    // Allocate on HEAP to avoid stack overflow (~300KB struct)
+    ShowV2 *v2 = (ShowV2 *)malloc(sizeof(ShowV2));
+    if (!v2) return 0;
+    
+    if (fread(v2, sizeof(ShowV2), 1, f) != 1) {
+        free(v2);
+        return 0;
+    }
+    
+    memcpy(out_show->name, v2->name, sizeof(out_show->name));
+    out_show->num_steps = v2->num_steps;
+    out_show->magic = v2->magic;
+    for (int s = 0; s < 200; s++) {
+        memcpy(&out_show->steps[s], v2->steps[s], STEP_CORE_SIZE);
+    }
+    free(v2);
+    return 1;
+}
+
+int show_read_stream(FILE *f, Show *out_show)
+{
+    if (!f || !out_show) return 0;
+    
+    // CRITICAL: Initialize entire Show structure to zero BEFORE loading
+    show_clear(out_show);
+    
+    // Get file size to detect format version
+    fseek(f, 0, SEEK_END);
+    long file_size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    
+    // Current format starts with its own magic
+    u32 file_magic = 0;
+    if (fread(&file_magic, sizeof(file_magic), 1, f) != 1) file_magic = 0;
+    fseek(f, 0, SEEK_SET);
+    
+    int ok;
+    if (file_magic == SHOW_FILE_MAGIC_V3) {
+        ok = read_show_v3(f, file_size, out_show);
+        if (!ok) {
+            show_clear(out_show);
+            return 0;
+        }
+    } else {
+        // Old format size: ~44868 bytes (64 + 200*224 + 4)
+        // v2 format size: ~300868 bytes (64 + 200*1504 + 4 + 4)
+        
+        // Check if this looks like old format by file size
+        if (file_size < 100000) {  // Conservatively assume < 100KB is old format
+            // Allocate old show on HEAP to avoid stack overflow
+            OldShow *old_show = (OldShow*)malloc(sizeof(OldShow));
+            if (!old_show) return 0;
+            
+            memset(old_show, 0, sizeof(OldShow));
+            size_t read = fread(old_show, sizeof(OldShow), 1, f);
+            
+            if (read == 1 && old_show->num_steps > 0 && old_show->num_steps <= 200) {
+                // Successfully loaded as old format, migrate to new
+                migrate_old_show_to_new(old_show, out_show);
+                free(old_show);
+                return 1;
+            }
+            // If migration failed, keep the zero-initialized structure
+            free(old_show);
+            return 0;
+        }
+        
+        // Load as v2 format - but first verify file size matches expected
+        if (file_size != (long)sizeof(ShowV2)) {
+            // File size mismatch - likely corrupted or compiled with different struct sizes
+            return 0;
+        }
+        
+        ok = read_show_v2(f, out_show);
+        
+        // Verify loaded data is sane
+        if (!ok) return 0;
+    }
+    
+    // Comprehensive validation of loaded data
+    if (out_show->num_steps < 1 || out_show->num_steps > 200) {
+        // Invalid step count
+        show_clear(out_show);
+        return 0;
+    }
+    
+    // Check magic number - but be tolerant of old files (magic == 0)
+    // Only fail if magic is non-zero AND not our expected value
+    if (out_show->magic != 0 && out_show->magic != SHOW_MAGIC) {
+        // File header is corrupted
+        show_clear(out_show);
+        return 0;
+    }
+    
+    // If magic is 0, set it now (was an old file)
+    if (out_show->magic == 0) {
+        out_show->magic = SHOW_MAGIC;
+    }
+    
+    // Additional sanity checks on first step
+    Step *first_step = &out_show->steps[0];
+    
+    // Check that volumes are in valid range
+    for (int i = 0; i < 16; i++) {
+        if (first_step->volumes[i] < 0.0f || first_step->volumes[i] > 1.0f) {
+            // Volume out of range - data corrupted
+            show_clear(out_show);
+            return 0;
+        }
+        // Check that mutes are 0 or 1
+        if (first_step->mutes[i] != 0 && first_step->mutes[i] != 1) {
+            // Invalid mute value
+            show_clear(out_show);
+            return 0;
+        }
+    }
+    
+    return 1;
+}
+
+int show_read_file(const char *path, Show *out_show)
+{
+    if (!path || !out_show) return 0;
+    
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        show_clear(out_show);
+        return 0;
+    }
+    int ok = show_read_stream(f, out_show);
+    fclose(f);
+    return ok;
+}
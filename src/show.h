@@ -0,0 +1,33 @@
+#ifndef SHOW_H
+#define SHOW_H
+
+#include <stdio.h>
+
+#include "types.h"
+
+// ============================================================================
+// SHOW MODEL AND FILES
+// ============================================================================
+// The show being run (Show, Step in types.h) and the .x18s file format.
+// Callers pick the path (SHOWS_DIR + name on the 3DS, anything on the host)
+// and hold the cue engine's show lock when the show is g_current_show.
+
+extern Show g_current_show;
+
+// Default EQ: all five bands flat, EQ off
+void init_channel_eq(ChannelEQ *eq);
+// Release the steps' parameter lists and zero the whole show.
+// The show must be zeroed or valid already (never raw malloc memory).
+void show_clear(Show *show);
+
+// Current format (v3). 1 on success
+int show_write_file(const char *path, const Show *show);
+// Any format this app has written (v3, v2, the original); validated and
+// migrated in memory. 1 on success, otherwise *out_show is left cleared.
+int show_read_file(const char *path, Show *out_show);
+// The same on an open stream, without the open, fsync and close (the host
+// benchmarks use them on memory streams)
+int show_write_stream(FILE *f, const Show *show);
+int show_read_stream(FILE *f, Show *out_show);
+
+#endif
@@ -1,4 +1,5 @@
 #include "common.h"
+#include "input.h"
 #include "show_manager_window.h"
 #include "network_config_window.h"
 #include "options_window.h"
@@ -150,7 +151,7 @@ void render_show_manager(void)
 
 void handle_manager_input(void)
 {
-    u32 kDown = hidKeysDown();
+    u32 kDown = input_keys_down();
     int touch_edge = g_isTouched && !g_wasTouched;
     
     // If network config window is open, handle its input
@@ -223,6 +224,7 @@ void handle_manager_input(void)
                 g_net_selected_field = 0;
                 g_net_keyboard_selected = 0;    // Start on first keyboard key
                 load_network_config_from_file();  // Load from file if exists
+                start_mixer_scan();               // Pick list of mixers on the subnet
             } else if (check_button_touch(6)) {  // Button 6 = EXIT
                 // EXIT button - save if modified, then close
                 if (g_show_modified) {
@@ -400,7 +402,7 @@ void render_rename_window_bot(void)
 
 void handle_rename_input(void)
 {
-    u32 kDown = hidKeysDown();
+    u32 kDown = input_keys_down();
     int touch_edge = g_isTouched && !g_wasTouched;
     
     if (!g_renaming) return;
@@ -0,0 +1,355 @@
+#include <string.h>
+#include <stdio.h>
+
+#include "log.h"
+#include "fader_taper.h"
+#include "show.h"
+#include "options.h"
+#include "cue_engine.h"
+#include "osc.h"
+#include "osc_query.h"
+#include "osc_targets.h"
+#include "snap_offload.h"
+
+#define SNAP_FILE           PLATFORM_DATA_DIR "/Snapshots"
+#define SNAP_FILE_MAGIC     0x58335350      // 'X3SP'
+
+#define SNAP_SETTLE_MS      60      // Step sent -> save
+#define SNAP_SAVE_MS        150     // Save -> verify
+#define SNAP_QUERY_MS       300
+#define SNAP_FLUSH_MS       2000    // Paced step sends (osc_pacer.h)
+#define SNAP_TRIES          2
+
+#define SNAP_ABORT_GO       1       // A live GO took over the console
+#define SNAP_ABORT_STOP     2       // Offload switched off
+
+typedef struct {
+    u32 magic;
+    char host[16];              // Console the slots were saved on
+    u32 hash[SNAP_SLOTS];       // Step content in the slot, 0 = unknown
+} SnapTable;
+
+static SnapTable s_table;
+static LightLock s_lock;        // Guards s_table and the report
+
+static Thread s_thread = NULL;
+static volatile int s_uploading = 0;
+static volatile int s_abort = 0;    // SNAP_ABORT_*
+static volatile int s_done = 0, s_total = 0;
+
+static SnapUploadReport s_report;
+static int s_report_ready = 0;
+
+// ============================================================================
+// STEP ELIGIBILITY
+// ============================================================================
+
+static u32 fnv1a(u32 h, const void *data, size_t len)
+{
+    const u8 *p = (const u8 *)data;
+    for (size_t i = 0; i < len; i++) {
+        h ^= p[i];
+        h *= 0x01000193u;
+    }
+    return h;
+}
+
+// Everything a per-parameter recall of the step depends on
+static u32 step_hash(const Step *step)
+{
+    u32 h = fnv1a(0x811C9DC5u, step, STEP_CORE_SIZE);
+    h = fnv1a(h, step->params.items, step->params.count * sizeof(ParamEntry));
+    u8 opts[2] = { (u8)g_options.send_fader, (u8)g_options.send_eq };
+    h = fnv1a(h, opts, sizeof(opts));
+    return h ? h : 1;
+}
+
+// Show lock held: a snapshot load would recall what send_step_osc() would
+static int step_offloadable(int step_idx)
+{
+    if (step_idx < 0 || step_idx >= SNAP_SLOTS || step_idx >= g_current_show.num_steps) return 0;
+
+    const Step *step = &g_current_show.steps[step_idx];
+    if (step->released_channels || step->released_groups || g_current_show.channel_safes) return 0;
+    for (int ch = 0; ch < 16; ch++) {
+        if (cue_fade_ms(step, ch)) return 0;
+    }
+    return 1;
+}
+
+static int slot_holds(int step_idx, u32 hash)
+{
+    LightLock_Lock(&s_lock);
+    int same = s_table.hash[step_idx] == hash && strcmp(s_table.host, g_mixer_host) == 0;
+    LightLock_Unlock(&s_lock);
+    return same;
+}
+
+static void slot_set(int step_idx, u32 hash)
+{
+    LightLock_Lock(&s_lock);
+    s_table.hash[step_idx] = hash;
+    LightLock_Unlock(&s_lock);
+}
+
+// ============================================================================
+// SLOT TABLE FILE
+// ============================================================================
+
+static void load_table(void)
+{
+    memset(&s_table, 0, sizeof(s_table));
+    FILE *f = fopen(SNAP_FILE, "rb");
+    if (!f) return;
+
+    SnapTable table;
+    if (fread(&table, sizeof(table), 1, f) == 1 && table.magic == SNAP_FILE_MAGIC) {
+        table.host[sizeof(table.host) - 1] = '\0';
+        s_table = table;
+    }
+    fclose(f);
+}
+
+static void save_table(void)
+{
+    LightLock_Lock(&s_lock);
+    SnapTable table = s_table;
+    LightLock_Unlock(&s_lock);
+
+    table.magic = SNAP_FILE_MAGIC;
+    FILE *f = fopen(SNAP_FILE, "wb");
+    if (!f) {
+        LOG_WARN("[SNAP] Cannot write %s", SNAP_FILE);
+        return;
+    }
+    fwrite(&table, sizeof(table), 1, f);
+    fclose(f);
+}
+
+// ============================================================================
+// UPLOAD THREAD
+// ============================================================================
+
+static void sleep_ms(u32 ms)
+{
+    svcSleepThread((s64)ms * 1000000LL);
+}
+
+// Apply the step, save it as the slot and read the slot back
+static int upload_step(int step_idx, u32 hash)
+{
+    const u16 name_id = PARAM_ID(PT_SNAP_NAME, 0, 0);
+    const u16 index_id = PARAM_ID(PT_SNAP_INDEX, 0, 0);
+
+    char tag[16];
+    snprintf(tag, sizeof(tag), "x3ds%08lX", (unsigned long)hash);
+
+    for (int attempt = 0; attempt < SNAP_TRIES && !s_abort; attempt++) {
+        // The step must be on the console before it is saved
+        cue_send_step(step_idx, 0);
+        osc_pacer_flush(osc_pacer(), SNAP_FLUSH_MS);
+        sleep_ms(SNAP_SETTLE_MS);
+        osc_send_param_string(name_id, tag);
+        osc_send_param(PARAM_ID(PT_SNAP_SAVE, 0, 0), step_idx);
+        osc_pacer_flush(osc_pacer(), SNAP_FLUSH_MS);
+        sleep_ms(SNAP_SAVE_MS);
+        if (s_abort) break;
+
+        int index;
+        char name[32];
+        if (osc_query_param(index_id, &index, SNAP_QUERY_MS) && index == step_idx &&
+            osc_query_param_string(name_id, name, sizeof(name), SNAP_QUERY_MS) &&
+            strcmp(name, tag) == 0) {
+            return 1;
+        }
+        LOG_WARN("[SNAP] Slot %d not verified (attempt %d)", step_idx + 1, attempt + 1);
+    }
+    return 0;
+}
+
+static void upload_thread_main(void *arg)
+{
+    (void)arg;
+    SnapUploadReport report = {0, 0, 0, 0};
+
+    // Slots saved on another console mean nothing here
+    LightLock_Lock(&s_lock);
+    if (strcmp(s_table.host, g_mixer_host) != 0) {
+        memset(s_table.hash, 0, sizeof(s_table.hash));
+        snprintf(s_table.host, sizeof(s_table.host), "%s", g_mixer_host);
+    }
+    LightLock_Unlock(&s_lock);
+
+    cue_lock_show();
+    int total = (g_current_show.num_steps < SNAP_SLOTS) ? g_current_show.num_steps : SNAP_SLOTS;
+    cue_unlock_show();
+    s_total = total;
+
+    for (int i = 0; i < total && !s_abort; i++) {
+        s_done = i;
+
+        cue_lock_show();
+        int eligible = step_offloadable(i);
+        u32 hash = eligible ? step_hash(&g_current_show.steps[i]) : 0;
+        cue_unlock_show();
+
+        if (!eligible) {
+            report.skipped++;
+            continue;
+        }
+        if (slot_holds(i, hash)) {
+            report.uploaded++;
+            continue;
+        }
+
+        // The slot is about to be overwritten
+        slot_set(i, 0);
+        int verified = upload_step(i, hash);
+
+        // Only trust the slot if nothing changed the step or fired meanwhile
+        cue_lock_show();
+        int unchanged = i < g_current_show.num_steps && step_hash(&g_current_show.steps[i]) == hash;
+        cue_unlock_show();
+        if (verified && unchanged && !s_abort) {
+            slot_set(i, hash);
+            report.uploaded++;
+        } else if (!s_abort) {
+            report.failed++;
+        }
+    }
+    s_done = total;
+    report.aborted = (s_abort != 0);
+
+    // Put the console back on the live cue, unless a GO already did
+    int last = cue_last_fired();
+    if (s_abort != SNAP_ABORT_GO && last >= 0) {
+        cue_send_step(last, 0);
+    }
+    save_table();
+
+    LOG_INFO("[SNAP] Upload %s: %d in slots, %d failed, %d skipped", report.aborted ? "stopped" : "done",
+             report.uploaded, report.failed, report.skipped);
+    LightLock_Lock(&s_lock);
+    s_report = report;
+    s_report_ready = 1;
+    LightLock_Unlock(&s_lock);
+    s_uploading = 0;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void snap_offload_init(void)
+{
+    LightLock_Init(&s_lock);
+    load_table();
+}
+
+void snap_offload_shutdown(void)
+{
+    if (s_thread) {
+        s_abort = SNAP_ABORT_STOP;
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    }
+}
+
+int snap_offload_start(void)
+{
+    if (s_uploading) return 0;
+
+    // Reap the previous upload's thread
+    if (s_thread) {
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    }
+
+    s_abort = 0;
+    s_done = 0;
+    s_total = 0;
+    s_uploading = 1;
+
+    // Below the main loop: the upload must never hold up the UI or a GO
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    s_thread = threadCreate(upload_thread_main, NULL, 8 * 1024, prio + 1, -2, false);
+    if (!s_thread) {
+        s_uploading = 0;
+        LOG_ERROR("[SNAP] Upload thread not started");
+        return 0;
+    }
+    LOG_INFO("[SNAP] Uploading steps to console snapshots");
+    return 1;
+}
+
+// Does not wait: the current step may still take a moment to finish
+void snap_offload_stop(void)
+{
+    if (s_uploading) s_abort = SNAP_ABORT_STOP;
+}
+
+int snap_offload_recall(int step_idx)
+{
+    if (!g_options.snap_offload) return 0;
+
+    if (s_uploading) {
+        // The upload's own sends go out per parameter; a live GO stops it
+        if (threadGetCurrent() != s_thread) s_abort = SNAP_ABORT_GO;
+        return 0;
+    }
+
+    if (!step_offloadable(step_idx)) return 0;
+    if (!slot_holds(step_idx, step_hash(&g_current_show.steps[step_idx]))) {
+        LOG_DEBUG("[SNAP] Slot %d stale, step %d sent per parameter", step_idx + 1, step_idx + 1);
+        return 0;
+    }
+
+    // The load replaces the whole scene: stop fades, and drop packets still
+    // queued from the previous GO so they cannot land after it (the load
+    // goes out in the first pacer class, ahead of them)
+    cue_fade_cancel_all();
+    u32 dropped = osc_pacer_clear(osc_pacer());
+    osc_targets_clear();
+    if (dropped) LOG_DEBUG("[SNAP] %lu queued packets superseded by the load", (unsigned long)dropped);
+    if (osc_send_param(PARAM_ID(PT_SNAP_LOAD, 0, 0), step_idx) <= 0) return 0;
+
+    // Restart the last-sent shadow from the step's positions
+    const Step *step = &g_current_show.steps[step_idx];
+    xair_shadow_reset();
+    if (g_options.send_fader) {
+        for (int ch = 0; ch < 16; ch++) {
+            xair_shadow_fader_set(ch, fader_value_to_step(step->volumes[ch]));
+        }
+    }
+    LOG_INFO("[SNAP] Step %d recalled from snapshot %d", step_idx + 1, step_idx + 1);
+    return 1;
+}
+
+int snap_offload_ready(int step_idx)
+{
+    if (!g_options.snap_offload || s_uploading || !step_offloadable(step_idx)) return 0;
+    return slot_holds(step_idx, step_hash(&g_current_show.steps[step_idx]));
+}
+
+int snap_offload_progress(int *out_done, int *out_total)
+{
+    if (!s_uploading) return 0;
+    *out_done = s_done;
+    *out_total = s_total;
+    return 1;
+}
+
+int snap_offload_take_report(SnapUploadReport *out)
+{
+    LightLock_Lock(&s_lock);
+    int ready = s_report_ready;
+    if (ready) {
+        *out = s_report;
+        s_report_ready = 0;
+    }
+    LightLock_Unlock(&s_lock);
+    return ready;
+}
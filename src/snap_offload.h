@@ -0,0 +1,53 @@
+#ifndef SNAP_OFFLOAD_H
+#define SNAP_OFFLOAD_H
+
+#include "platform.h"
+
+// ============================================================================
+// CONSOLE SNAPSHOT OFFLOAD
+// ============================================================================
+// A full step recall is over 100 messages. With offload on, steps 1-64 are
+// uploaded into the X18's snapshot slots (step n -> slot n) and a GO on an
+// uploaded step is a single /-snap/load.
+//
+// Upload: for each step, send it, name the console's current snapshot with
+// a tag of the step's content hash, /-snap/save it to the slot, then read
+// back /-snap/index and /-snap/name to verify. It runs on a background
+// thread, but the console is driven through every step while it does, so
+// it belongs before the show: a GO during the upload stops it. Steps
+// already in their slot are skipped. Afterwards the last fired step is
+// sent again.
+//
+// A GO uses the slot only when it recalls exactly what the per-parameter
+// send would: the slot was verified with the step's current content on the
+// current console, the step recalls every channel and group, the show has
+// no channel safes and no fader fades apply. Anything else (or a stale
+// slot) falls back to the per-parameter send. A snapshot also restores
+// whatever else was on the console at upload time.
+//
+// The slot table is kept in /3ds/x18mixer/Snapshots.
+
+#define SNAP_SLOTS  64
+
+void snap_offload_init(void);
+void snap_offload_shutdown(void);
+
+int snap_offload_start(void);           // 0 if an upload is already running
+void snap_offload_stop(void);
+
+// From send_step_osc() (show lock held): 1 if the step went out as a
+// snapshot load and nothing else needs sending
+int snap_offload_recall(int step_idx);
+int snap_offload_ready(int step_idx);   // Main thread: a GO would load the slot
+
+typedef struct {
+    int uploaded;           // Verified in their slot (including already up to date)
+    int failed;             // Not verified after retries
+    int skipped;            // Not eligible (scope, safes, fades)
+    int aborted;
+} SnapUploadReport;
+
+int snap_offload_progress(int *out_done, int *out_total);  // 1 while uploading
+int snap_offload_take_report(SnapUploadReport *out);       // 1 once per finished upload
+
+#endif
@@ -0,0 +1,207 @@
+#include <string.h>
+#include <stdlib.h>
+
+#include "log.h"
+#include "fader_taper.h"
+#include "show.h"
+#include "osc.h"
+#include "cue_engine.h"
+#include "osc_query.h"
+#include "step_capture.h"
+
+#define CAPTURE_FIXED_PER_CH    (3 + 5 * 4)     // Fader, mute, EQ on + bands
+
+static Thread s_thread = NULL;
+static volatile int s_busy = 0;
+static volatile int s_done = 0;
+static volatile int s_cancelled = 0;    // The show was replaced while querying
+
+static int s_step_idx;
+static u16 *s_ids = NULL;
+static int *s_steps = NULL;
+static int s_count = 0;
+static OscQueryStats s_stats;
+
+// ============================================================================
+// QUERY LIST
+// ============================================================================
+
+static int build_ids(const Step *step, u16 *ids)
+{
+    static const u8 band_templates[4] = { PT_CH_EQ_TYPE, PT_CH_EQ_F, PT_CH_EQ_G, PT_CH_EQ_Q };
+    int n = 0;
+
+    for (int ch = 0; ch < 16; ch++) {
+        ids[n++] = PARAM_ID(PT_CH_MIX_FADER, ch, 0);
+        ids[n++] = PARAM_ID(PT_CH_MIX_ON, ch, 0);
+        ids[n++] = PARAM_ID(PT_CH_EQ_ON, ch, 0);
+        for (int band = 0; band < 5; band++) {
+            for (int p = 0; p < 4; p++) {
+                ids[n++] = PARAM_ID(band_templates[p], ch, band);
+            }
+        }
+    }
+    for (int i = 0; i < step->params.count; i++) {
+        ids[n++] = step->params.items[i].id;
+    }
+    return n;
+}
+
+// Store one answer where the step keeps that parameter
+static void apply_value(Step *step, u16 id, int value)
+{
+    int ch = PARAM_INDEX_A(id);
+    int band = PARAM_INDEX_B(id);
+
+    switch (PARAM_TEMPLATE(id)) {
+    case PT_CH_MIX_FADER:
+        step->volumes[ch] = fader_step_to_value(value);
+        break;
+    case PT_CH_MIX_ON:
+        step->mutes[ch] = (value == 0);
+        break;
+    case PT_CH_EQ_ON:
+        step->eqs[ch].enabled = (value != 0);
+        break;
+    case PT_CH_EQ_TYPE:
+        step->eqs[ch].bands[band].type = (EQFilterType)value;
+        break;
+    case PT_CH_EQ_F:
+        step->eqs[ch].bands[band].frequency = param_step_to_value(id, value);
+        break;
+    case PT_CH_EQ_G:
+        step->eqs[ch].bands[band].gain = param_step_to_value(id, value);
+        break;
+    case PT_CH_EQ_Q:
+        step->eqs[ch].bands[band].q_factor = param_step_to_value(id, value);
+        break;
+    default:
+        param_list_set(&step->params, id, (u16)value);
+        break;
+    }
+}
+
+// ============================================================================
+// CAPTURE THREAD
+// ============================================================================
+
+static void capture_thread_main(void *arg)
+{
+    (void)arg;
+    osc_query_params(s_ids, s_count, s_steps, CAPTURE_WINDOW, CAPTURE_TIMEOUT_MS,
+                     CAPTURE_RETRIES, &s_stats);
+    s_done = 1;
+}
+
+static void free_buffers(void)
+{
+    free(s_ids);
+    free(s_steps);
+    s_ids = NULL;
+    s_steps = NULL;
+    s_count = 0;
+}
+
+int step_capture_start(int step_idx)
+{
+    if (s_busy || step_idx < 0 || step_idx >= g_current_show.num_steps) return 0;
+    if (!g_osc_connected) {
+        LOG_WARN("[CAPTURE] OSC not connected");
+        return 0;
+    }
+
+    // Reap the previous capture's thread
+    if (s_thread) {
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    }
+
+    const Step *step = &g_current_show.steps[step_idx];
+    int max = 16 * CAPTURE_FIXED_PER_CH + step->params.count;
+    s_ids = (u16 *)malloc(max * sizeof(u16));
+    s_steps = (int *)malloc(max * sizeof(int));
+    if (!s_ids || !s_steps) {
+        LOG_ERROR("[CAPTURE] Out of memory for %d queries", max);
+        free_buffers();
+        return 0;
+    }
+    s_count = build_ids(step, s_ids);
+    s_step_idx = step_idx;
+    s_done = 0;
+    s_cancelled = 0;
+    s_busy = 1;
+
+    // Replies are collected as they come; keep it ahead of the main loop
+    s32 prio = 0x30;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    s_thread = threadCreate(capture_thread_main, NULL, 8 * 1024, prio - 1, -2, false);
+    if (!s_thread) {
+        LOG_ERROR("[CAPTURE] Capture thread not started");
+        free_buffers();
+        s_busy = 0;
+        return 0;
+    }
+    LOG_INFO("[CAPTURE] Querying %d parameters for step %d", s_count, step_idx + 1);
+    return 1;
+}
+
+int step_capture_busy(void)
+{
+    return s_busy;
+}
+
+int step_capture_finish(StepCaptureReport *out)
+{
+    if (!s_busy || !s_done) return 0;
+
+    threadJoin(s_thread, U64_MAX);
+    threadFree(s_thread);
+    s_thread = NULL;
+
+    // The answers belong to a show that is no longer loaded
+    if (s_cancelled) {
+        LOG_INFO("[CAPTURE] Step %d discarded: show replaced", s_step_idx + 1);
+        free_buffers();
+        s_busy = 0;
+        return 0;
+    }
+
+    // The step list may have changed meanwhile; the index must still exist
+    if (s_step_idx < g_current_show.num_steps) {
+        cue_lock_show();
+        Step *step = &g_current_show.steps[s_step_idx];
+        for (int i = 0; i < s_count; i++) {
+            if (s_steps[i] >= 0) apply_value(step, s_ids[i], s_steps[i]);
+        }
+        cue_unlock_show();
+    }
+
+    out->step_idx = s_step_idx;
+    out->queried = s_count;
+    out->answered = s_stats.answered;
+    out->retries = s_stats.retries;
+    out->elapsed_us = s_stats.elapsed_us;
+    LOG_INFO("[CAPTURE] Step %d: %d/%d answered, %d resent, %lu us", s_step_idx + 1,
+             out->answered, out->queried, out->retries, (unsigned long)out->elapsed_us);
+
+    free_buffers();
+    s_busy = 0;
+    return 1;
+}
+
+void step_capture_cancel(void)
+{
+    if (s_busy) s_cancelled = 1;
+}
+
+void step_capture_shutdown(void)
+{
+    if (s_thread) {
+        threadJoin(s_thread, U64_MAX);
+        threadFree(s_thread);
+        s_thread = NULL;
+    }
+    free_buffers();
+    s_busy = 0;
+}
@@ -0,0 +1,38 @@
+#ifndef STEP_CAPTURE_H
+#define STEP_CAPTURE_H
+
+#include "platform.h"
+
+// ============================================================================
+// STEP CAPTURE ("learn step from console")
+// ============================================================================
+// Reads the console's current values for everything a step stores: fader,
+// mute, EQ on and the 5 EQ bands of all 16 channels, plus every parameter
+// already in the step's list. The queries are pipelined (osc_query_params)
+// with CAPTURE_WINDOW in flight and resent on timeout, on a background
+// thread. The main loop then writes the answers into the step with
+// step_capture_finish(). Parameters the console did not answer keep their
+// old value. Replacing the show cancels a running capture: its answers are
+// dropped instead of landing in the new show.
+
+#define CAPTURE_WINDOW      16
+#define CAPTURE_TIMEOUT_MS  80
+#define CAPTURE_RETRIES     3
+
+typedef struct {
+    int step_idx;
+    int queried;
+    int answered;
+    int retries;
+    u32 elapsed_us;
+} StepCaptureReport;
+
+int step_capture_start(int step_idx);       // 0 if a capture is running
+int step_capture_busy(void);
+// Main thread, every frame: 1 once a capture finished and was written
+// into its step
+int step_capture_finish(StepCaptureReport *out);
+void step_capture_cancel(void);             // The show is being replaced
+void step_capture_shutdown(void);
+
+#endif
@@ -0,0 +1,84 @@
+#include "trace.h"
+
+#ifdef X18_TRACE
+
+#include <stdio.h>
+#include <string.h>
+
+// ============================================================================
+// RING BUFFER
+// ============================================================================
+
+typedef struct {
+    u64 tick;
+    const char *name;
+    u8 phase;
+    u8 tid;
+} TraceEvent;
+
+static TraceEvent s_ring[TRACE_RING_SIZE];
+static u32 s_write_idx = 0;          // Monotonic; slot = idx & (TRACE_RING_SIZE - 1)
+static volatile int s_paused = 0;    // Set while flushing
+static u32 s_next_tid = 0;
+static __thread u8 t_tid = 0;        // Per-thread id, assigned on first event
+
+// Lock-free: any thread may record, the oldest events are overwritten
+void trace_event(const char *name, char phase)
+{
+    if (s_paused) return;
+
+    if (t_tid == 0) {
+        t_tid = (u8)__atomic_add_fetch(&s_next_tid, 1, __ATOMIC_RELAXED);
+    }
+
+    u32 idx = __atomic_fetch_add(&s_write_idx, 1, __ATOMIC_RELAXED);
+    TraceEvent *e = &s_ring[idx & (TRACE_RING_SIZE - 1)];
+    e->tick = svcGetSystemTick();
+    e->name = name;
+    e->phase = (u8)phase;
+    e->tid = t_tid;
+}
+
+// ============================================================================
+// CHROME TRACE EXPORT
+// ============================================================================
+
+int trace_flush(const char *path)
+{
+    s_paused = 1;
+
+    u32 end = __atomic_load_n(&s_write_idx, __ATOMIC_ACQUIRE);
+    u32 count = (end < TRACE_RING_SIZE) ? end : TRACE_RING_SIZE;
+    u32 start = end - count;
+
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        s_paused = 0;
+        return 0;
+    }
+
+    // One big buffer instead of thousands of small SD writes
+    static char io_buf[16 * 1024];
+    setvbuf(f, io_buf, _IOFBF, sizeof(io_buf));
+
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    u64 base_tick = count ? s_ring[start & (TRACE_RING_SIZE - 1)].tick : 0;
+    for (u32 i = 0; i < count; i++) {
+        const TraceEvent *e = &s_ring[(start + i) & (TRACE_RING_SIZE - 1)];
+        double ts_us = (double)(e->tick - base_tick) / CPU_TICKS_PER_USEC;
+
+        fprintf(f, "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u%s}%s\n",
+                e->name ? e->name : "?", e->phase, ts_us, e->tid,
+                (e->phase == 'i') ? ",\"s\":\"t\"" : "",
+                (i + 1 < count) ? "," : "");
+    }
+
+    fprintf(f, "]}\n");
+    fclose(f);
+
+    s_paused = 0;
+    return 1;
+}
+
+#endif
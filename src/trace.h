@@ -0,0 +1,41 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "platform.h"
+
+// ============================================================================
+// EVENT TRACING (Chrome trace format)
+// ============================================================================
+// Build with `make TRACE=1` to record begin/end/instant events into a fixed
+// in-memory ring. Without X18_TRACE every macro expands to nothing and no
+// trace code is linked.
+//
+// Names must be string literals (only the pointer is stored).
+//
+// ZL+ZR + X writes the ring to TRACE_JSON_PATH; it is also written on exit.
+// Open it in chrome://tracing or https://ui.perfetto.dev
+
+#define TRACE_JSON_PATH PLATFORM_DATA_DIR "/trace.json"
+
+#ifdef X18_TRACE
+
+#define TRACE_RING_SIZE 8192    // Events, must be a power of two
+
+void trace_event(const char *name, char phase);
+int trace_flush(const char *path);
+
+#define TRACE_BEGIN(name)   trace_event((name), 'B')
+#define TRACE_END(name)     trace_event((name), 'E')
+#define TRACE_INSTANT(name) trace_event((name), 'i')
+#define TRACE_FLUSH()       trace_flush(TRACE_JSON_PATH)
+
+#else
+
+#define TRACE_BEGIN(name)   ((void)0)
+#define TRACE_END(name)     ((void)0)
+#define TRACE_INSTANT(name) ((void)0)
+#define TRACE_FLUSH()       ((void)0)
+
+#endif
+
+#endif
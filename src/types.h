@@ -1,7 +1,9 @@
 #ifndef TYPES_H
 #define TYPES_H
 
-#include <citro2d.h>
+#include "platform.h"
+#include <stddef.h>
+#include "param.h"
 
 // ============================================================================
 // MIXER DEFINITIONS
@@ -18,7 +20,7 @@
 // SHOW MANAGER DEFINITIONS
 // ============================================================================
 
-#define SHOWS_DIR "/3ds/x18mixer/shows/"
+#define SHOWS_DIR PLATFORM_DATA_DIR "/shows/"
 #define MAX_SHOWS 64
 
 // Manager buttons
@@ -74,18 +76,49 @@ typedef struct {
 // SHOW/STEP STRUCTURES
 // ============================================================================
 
+// Not packed: the fields are already 4-byte aligned with no padding, and the
+// parameter list pointer must be addressable
 typedef struct {
     char name[32];
     float volumes[16];
     int mutes[16];
     ChannelEQ eqs[16];    // EQ settings per channel
-} __attribute__((packed)) Step;
+    ParamList params;     // Any other console parameters, sorted by id (param.h)
+    u16 released_channels;  // Recall scope: bit ch set = this cue leaves the channel alone
+    u8 released_groups;     // Recall scope: STEP_SCOPE_* bits this cue leaves alone
+    u16 fade_tenths;                // Fader crossfade time, 0.1 s units (0 = instant)
+    u16 channel_fade_tenths[16];    // Per-channel override, 0 = use fade_tenths
+    u8 follow_mode;                 // STEP_FOLLOW_*: how the step fires by itself
+    u32 follow_ms;                  // Delay after the previous step, or time from show start
+} Step;
+
+// Auto-follow (see cue_engine.h)
+#define STEP_FOLLOW_NONE    0   // Manual GO only
+#define STEP_FOLLOW_AFTER   1   // follow_ms after the previous step fired
+#define STEP_FOLLOW_AT      2   // follow_ms after step 1 fired
+#define STEP_FOLLOW_MODES   3
+
+// Recall scope groups. Masks are stored inverted (set = not recalled) so a
+// zeroed step recalls everything, as steps always did.
+#define STEP_SCOPE_FADER    (1 << 0)
+#define STEP_SCOPE_MUTE     (1 << 1)
+#define STEP_SCOPE_EQ       (1 << 2)
+#define STEP_SCOPE_PARAMS   (1 << 3)    // Everything in Step.params
+#define STEP_SCOPE_ALL      0x0F
+
+// Fixed part of a step as written to show files (everything before params)
+#define STEP_CORE_SIZE offsetof(Step, params)
+_Static_assert(STEP_CORE_SIZE == 1504, "Step fixed part no longer matches the show file layout");
 
 typedef struct {
     char name[64];
     Step steps[200];
     int num_steps;
     int magic;  // Magic number for validation: 0x58334D32 ('X', '3', '4', 'M') = X34M = X18Mix ver 2
-} __attribute__((packed)) Show;
+    u16 channel_safes;    // Bit ch set = no step recall touches the channel
+} Show;
+
+#define SHOW_MAGIC          0x58334D32  // In memory, and v2 files (raw Show dump)
+#define SHOW_FILE_MAGIC_V3  0x58334D33  // Length-prefixed step records
 
 #endif
@@ -0,0 +1,70 @@
+#include "xair_codec.h"
+#include "fader_taper.h"
+
+#include <string.h>
+
+// ============================================================================
+// INIT / NAMES
+// ============================================================================
+
+void xair_codec_init(void)
+{
+    fader_taper_init();
+    xair_shadow_reset();
+}
+
+const char *xair_eq_param_name(XAirEqParam param)
+{
+    static const char *names[XAIR_EQ_NUM_PARAMS] = { "type", "f", "g", "q" };
+    return (param >= 0 && param < XAIR_EQ_NUM_PARAMS) ? names[param] : "?";
+}
+
+// ============================================================================
+// LAST-SENT SHADOW
+// ============================================================================
+
+static u16 s_shadow_fader[XAIR_SHADOW_CHANNELS];
+static u16 s_shadow_eq[XAIR_SHADOW_CHANNELS][XAIR_SHADOW_BANDS][XAIR_EQ_NUM_PARAMS];
+
+void xair_shadow_reset(void)
+{
+    memset(s_shadow_fader, 0xFF, sizeof(s_shadow_fader));
+    memset(s_shadow_eq, 0xFF, sizeof(s_shadow_eq));
+}
+
+static int eq_index_ok(int channel, int band, XAirEqParam param)
+{
+    return channel >= 0 && channel < XAIR_SHADOW_CHANNELS &&
+           band >= 0 && band < XAIR_SHADOW_BANDS &&
+           param >= 0 && param < XAIR_EQ_NUM_PARAMS;
+}
+
+int xair_shadow_fader_same(int channel, int step)
+{
+    if (channel < 0 || channel >= XAIR_SHADOW_CHANNELS) return 0;
+    return s_shadow_fader[channel] == (u16)step;
+}
+
+int xair_shadow_fader_get(int channel)
+{
+    if (channel < 0 || channel >= XAIR_SHADOW_CHANNELS) return XAIR_STEP_UNKNOWN;
+    return s_shadow_fader[channel];
+}
+
+void xair_shadow_fader_set(int channel, int step)
+{
+    if (channel < 0 || channel >= XAIR_SHADOW_CHANNELS) return;
+    s_shadow_fader[channel] = (u16)step;
+}
+
+int xair_shadow_eq_same(int channel, int band, XAirEqParam param, int step)
+{
+    if (!eq_index_ok(channel, band, param)) return 0;
+    return s_shadow_eq[channel][band][param] == (u16)step;
+}
+
+void xair_shadow_eq_set(int channel, int band, XAirEqParam param, int step)
+{
+    if (!eq_index_ok(channel, band, param)) return;
+    s_shadow_eq[channel][band][param] = (u16)step;
+}
@@ -0,0 +1,45 @@
+#ifndef XAIR_CODEC_H
+#define XAIR_CODEC_H
+
+#include "platform.h"
+
+// ============================================================================
+// X-AIR PARAMETER CODEC
+// ============================================================================
+// Value <-> step conversion lives in the parameter registry (param.h), so
+// what is sent, verified and captured shares one grid. This module keeps
+// the EQ leaf names and the last-sent shadow on top of it.
+
+// EQ band parameters, in the order of the /ch/XX/eq/B/<param> leaves
+typedef enum {
+    XAIR_EQ_TYPE,       // int 0..5 (EQFilterType)
+    XAIR_EQ_FREQ,
+    XAIR_EQ_GAIN,
+    XAIR_EQ_Q,
+    XAIR_EQ_NUM_PARAMS
+} XAirEqParam;
+
+#define XAIR_STEP_UNKNOWN   0xFFFF
+
+void xair_codec_init(void);                          // Fader taper + shadow reset
+
+const char *xair_eq_param_name(XAirEqParam param);   // "type", "f", "g", "q"
+
+// ============================================================================
+// LAST-SENT SHADOW
+// ============================================================================
+// Step index of the last value successfully sent per parameter, so a send
+// that would land on the same console step can be recognised. Reset to
+// unknown whenever the link is (re)opened.
+
+#define XAIR_SHADOW_CHANNELS    16
+#define XAIR_SHADOW_BANDS       5
+
+void xair_shadow_reset(void);
+int xair_shadow_fader_same(int channel, int step);
+int xair_shadow_fader_get(int channel);             // XAIR_STEP_UNKNOWN if never sent
+void xair_shadow_fader_set(int channel, int step);
+int xair_shadow_eq_same(int channel, int band, XAirEqParam param, int step);
+void xair_shadow_eq_set(int channel, int band, XAirEqParam param, int step);
+
+#endif
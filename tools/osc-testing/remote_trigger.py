@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+Send remote cue triggers to the 3DS mixer's OSC control port.
+
+Usage:
+    remote_trigger.py <3ds-ip> go
+    remote_trigger.py <3ds-ip> back
+    remote_trigger.py <3ds-ip> goto <step>
+    remote_trigger.py <3ds-ip> fade <seconds> [step]
+    remote_trigger.py <3ds-ip> ping [count]
+
+Every trigger prints the /x18mixer/ack reply: the step that fired, the time
+the 3DS took from receive to send, and the round trip seen from here. ping
+measures the bare network round trip through /x18mixer/pong.
+
+Options:
+    --port N    control port (default 9000). The 3DS only listens once
+                [OSC_CONTROL] port=N is set in Options; it is off by default.
+"""
+
+import socket
+import struct
+import sys
+import time
+
+DEFAULT_PORT = 9000
+TIMEOUT_S = 1.0
+
+
+def osc_string(s):
+    data = s.encode() + b"\0"
+    return data + b"\0" * (-len(data) % 4)
+
+
+def osc_message(address, *args):
+    tags = ","
+    payload = b""
+    for arg in args:
+        if isinstance(arg, int):
+            tags += "i"
+            payload += struct.pack(">i", arg)
+        elif isinstance(arg, float):
+            tags += "f"
+            payload += struct.pack(">f", arg)
+        else:
+            tags += "s"
+            payload += osc_string(str(arg))
+    return osc_string(address) + osc_string(tags) + payload
+
+
+def read_string(data, pos):
+    end = data.index(b"\0", pos)
+    return data[pos:end].decode(errors="replace"), (end + 4) & ~3
+
+
+def parse_message(data):
+    address, pos = read_string(data, 0)
+    if pos >= len(data) or data[pos:pos + 1] != b",":
+        return address, []
+    tags, pos = read_string(data, pos)
+    args = []
+    for t in tags[1:]:
+        if t == "i":
+            args.append(struct.unpack(">i", data[pos:pos + 4])[0])
+            pos += 4
+        elif t == "f":
+            args.append(struct.unpack(">f", data[pos:pos + 4])[0])
+            pos += 4
+        elif t == "s":
+            value, pos = read_string(data, pos)
+            args.append(value)
+    return address, args
+
+
+def exchange(sock, target, packet):
+    """Send one packet and wait for the reply. Returns (address, args, rtt_ms)."""
+    start = time.perf_counter()
+    sock.sendto(packet, target)
+    try:
+        data, _ = sock.recvfrom(1024)
+    except socket.timeout:
+        return None, None, None
+    rtt_ms = (time.perf_counter() - start) * 1000.0
+    address, args = parse_message(data)
+    return address, args, rtt_ms
+
+
+def ping(sock, target, count):
+    rtts = []
+    for seq in range(count):
+        address, args, rtt = exchange(sock, target, osc_message("/x18mixer/ping", seq))
+        if address != "/x18mixer/pong" or args != [seq]:
+            print(f"ping {seq}: no reply")
+            continue
+        rtts.append(rtt)
+        print(f"ping {seq}: {rtt:.2f} ms")
+        time.sleep(0.1)
+    if rtts:
+        rtts.sort()
+        print(f"{len(rtts)}/{count} replies, min {rtts[0]:.2f} / "
+              f"median {rtts[len(rtts) // 2]:.2f} / max {rtts[-1]:.2f} ms")
+    return 0 if rtts else 1
+
+
+def main(argv):
+    port = DEFAULT_PORT
+    if "--port" in argv:
+        i = argv.index("--port")
+        port = int(argv[i + 1])
+        del argv[i:i + 2]
+
+    if len(argv) < 3:
+        print(__doc__)
+        return 2
+
+    target = (argv[1], port)
+    command = argv[2]
+    params = argv[3:]
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(TIMEOUT_S)
+
+    if command == "ping":
+        return ping(sock, target, int(params[0]) if params else 10)
+
+    if command in ("go", "back"):
+        packet = osc_message(f"/x18mixer/{command}")
+    elif command == "goto" and len(params) == 1:
+        packet = osc_message("/x18mixer/goto", int(params[0]))
+    elif command == "fade" and len(params) in (1, 2):
+        args = [float(params[0])] + [int(p) for p in params[1:]]
+        packet = osc_message("/x18mixer/fade", *args)
+    else:
+        print(__doc__)
+        return 2
+
+    address, args, rtt = exchange(sock, target, packet)
+    if address != "/x18mixer/ack" or len(args) != 3:
+        print("No acknowledgement (control port off, or wrong address?)")
+        return 1
+
+    _, step, handle_us = args
+    if step == 0:
+        print(f"{command}: nothing fired, round trip {rtt:.2f} ms")
+        return 1
+    print(f"{command}: step {step} fired, {handle_us} us on the 3DS, "
+          f"round trip {rtt:.2f} ms")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -1,43 +1,44 @@
 #!/bin/bash
 
-# X32 Emulator Launcher for X18 Mixer 3DS OSC Testing
-# This script starts the X32 emulator which serves as a testing tool
-# for OSC communication (X32 and X18 use compatible OSC protocols)
+# X18 stand-in launcher for X18 Mixer 3DS OSC Testing
+# Builds and starts build_host/x18sim (host/x18sim.c), a UDP server that
+# answers like an XR18: it keeps the parameter tree, answers queries and
+# /xinfo, sends /xremote feedback and /meters, and can drop, delay and
+# reorder packets. Extra arguments are passed through, e.g.
+#
+#   ./start-emulator.sh --loss 5 --latency 20 --jitter 10 --reorder 2
 
 # Configuration
-EMULATOR_PATH="/Users/lorenzomazzocchetti/Desktop/Github/X32-Behringer/build/X32"
-LOG_FILE="./x32-emulator.log"
-IP_ADDRESS="auto"        # Auto-detect from system network
-PORT=10023               # X32 standard OSC port (X18 also uses 10024, but emulator defaults to 10023)
-VERBOSE=1                # 1 = verbose mode (see all OSC commands)
-DEBUG=0                  # 1 = debug mode
+REPO_DIR="$(cd "$(dirname "$0")/../.." && pwd)"
+SIM="$REPO_DIR/build_host/x18sim"
+LOG_FILE="./x18sim.log"
+PORT=10023               # Same as g_mixer_port and the real console
+VERBOSE=1                # 1 = print every received message
 
 echo "=========================================="
-echo "X32 Emulator for X18 Mixer OSC Testing"
+echo "X18 stand-in for X18 Mixer OSC Testing"
 echo "=========================================="
 echo ""
-echo "Starting X32 emulator..."
-echo "  IP: $IP_ADDRESS"
+echo "Building..."
+make -s -C "$REPO_DIR" -f Makefile.host sim || exit 1
+echo ""
 echo "  Port: $PORT"
 echo "  Verbose: $VERBOSE"
 echo "  Log file: $LOG_FILE"
 echo ""
 echo "Commands:"
-echo "  - Query: /info"
+echo "  - Identify: /xinfo"
 echo "  - Set fader: /ch/01/mix/fader ,f 0.5"
 echo "  - Query fader: /ch/01/mix/fader"
-echo "  - Shutdown: /shutdown"
+echo "  - Feedback: /xremote (renew every 10 s)"
+echo "  - Stop: Ctrl+C"
 echo ""
 echo "=========================================="
 echo ""
 
-# Check if emulator exists
-if [ ! -f "$EMULATOR_PATH" ]; then
-    echo "ERROR: X32 emulator not found at $EMULATOR_PATH"
-    echo "Please build it with: cd /Users/lorenzomazzocchetti/Desktop/Github/X32-Behringer && make X32"
-    exit 1
+ARGS=(-p "$PORT")
+if [ "$VERBOSE" = "1" ]; then
+    ARGS+=(-v)
 fi
 
-# Start emulator with specified options
-# Note: -i option will be overridden by the system's default IP
-$EMULATOR_PATH -d $DEBUG -v $VERBOSE 2>&1 | tee "$LOG_FILE"
+"$SIM" "${ARGS[@]}" "$@" 2>&1 | tee "$LOG_FILE"